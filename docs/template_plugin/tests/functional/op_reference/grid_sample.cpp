@@ -493,6 +493,35 @@ std::vector<GridSampleParams> generateBicubicBatchesParams() {
     return params;
 }
 
+std::vector<GridSampleParams> generateReflectionAlignParamsSingleElementDimensions() {
+    std::vector<GridSampleParams> params;
+
+    // the single element dimensions reflect into the element itself, whatever the grid is
+    reference_tests::Tensor data{{1, 2, 1, 1}, element::f32, std::vector<float>{3, 7}};
+    reference_tests::Tensor grid{{1, 1, 3, 2}, element::f32, std::vector<float>{-1, -1, 0.3, 0.7, 2.5, -3.25}};
+    reference_tests::Tensor output{{1, 2, 1, 3}, element::f32, std::vector<float>{3, 3, 3, 7, 7, 7}};
+
+    params.emplace_back(data,
+                        grid,
+                        op::v9::GridSample::Attributes{true, GS_NEAREST, GS_REFLECTION},
+                        output,
+                        "nearest_reflection_align_single_element_dims");
+
+    params.emplace_back(data,
+                        grid,
+                        op::v9::GridSample::Attributes{true, GS_BILINEAR, GS_REFLECTION},
+                        output,
+                        "bilinear_reflection_align_single_element_dims");
+
+    params.emplace_back(data,
+                        grid,
+                        op::v9::GridSample::Attributes{true, GS_BICUBIC, GS_REFLECTION},
+                        output,
+                        "bicubic_reflection_align_single_element_dims");
+
+    return params;
+}
+
 std::vector<GridSampleParams> generateGridSampleParams() {
     std::vector<std::vector<GridSampleParams>> combo_params{generateNearestParamsOddDimensionsInnerGrids(),
                                                             generateNearestParamsOddDimensionsOuterGrids(),
@@ -501,7 +530,8 @@ std::vector<GridSampleParams> generateGridSampleParams() {
                                                             generateBilinearParamsOddDimensionsOuterGrids(),
                                                             generateBilinearParamsEvenDimensions(),
                                                             generateBicubicParams(),
-                                                            generateBicubicBatchesParams()};
+                                                            generateBicubicBatchesParams(),
+                                                            generateReflectionAlignParamsSingleElementDimensions()};
     std::vector<GridSampleParams> test_params;
     for (auto& params : combo_params)
         std::move(params.begin(), params.end(), std::back_inserter(test_params));
@@ -127,6 +127,52 @@ INSTANTIATE_TEST_SUITE_P(
                         "loop_dynamic_inputs")),
         ReferenceLoopLayerTest::getTestCaseName);
 
+// the body increments the merged input, the increments are concatenated with the negative stride,
+// so the value of the last iteration goes first
+struct LoopReverseConcatenation : public LoopFunctionalBase {
+    std::shared_ptr<ov::Model> create_function(const std::vector<reference_tests::Tensor>& loop_inputs,
+                                               const std::vector<reference_tests::Tensor>& results,
+                                               const int64_t& trip_count_value,
+                                               const std::vector<LOOP_IN_TYPE>& loop_in_type,
+                                               const ov::element::Type& net_type) override {
+        auto M = std::make_shared<ov::opset8::Parameter>(loop_inputs[0].type, loop_inputs[0].shape);
+
+        // Body parameters
+        auto M_body = std::make_shared<ov::opset8::Parameter>(loop_inputs[0].type, ov::PartialShape::dynamic());
+        auto body_condition = std::make_shared<ov::opset8::Constant>(ov::element::boolean, ov::Shape{1}, true);
+
+        auto trip_count = std::make_shared<ov::opset8::Constant>(ov::element::i64, ov::Shape{1}, 3);
+        auto exec_condition = std::make_shared<ov::opset8::Constant>(ov::element::boolean, ov::Shape{1}, true);
+        // Body
+        auto one = std::make_shared<ov::opset8::Constant>(loop_inputs[0].type, ov::Shape{1}, 1);
+        auto Zo = std::make_shared<ov::opset8::Add>(M_body, one);
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_condition, Zo}, ov::ParameterVector{M_body});
+
+        auto loop = std::make_shared<ov::opset8::Loop>(trip_count, exec_condition);
+        loop->set_function(body);
+        loop->set_merged_input(M_body, M, Zo);
+        loop->set_special_body_ports(ov::opset8::Loop::SpecialBodyPorts{-1, 0});
+
+        // start=-1, stride=-1, part_size=1, end=0, axis=0
+        auto result = std::make_shared<ov::opset8::Result>(loop->get_concatenated_slices(Zo, -1, -1, 1, 0, 0));
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{M});
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        smoke_Loop_Reverse_Concatenation_With_Hardcoded_Refs,
+        ReferenceLoopLayerTest,
+        ::testing::Values(
+                LoopParams(
+                        std::make_shared<LoopReverseConcatenation>(),
+                        std::vector<reference_tests::Tensor>{
+                                reference_tests::Tensor(ov::element::f32, ov::Shape{1, 2}, std::vector<float>{0, 1})},
+                        // the iterations give {1, 2}, {2, 3} and {3, 4}
+                        std::vector<reference_tests::Tensor>{
+                                reference_tests::Tensor(ov::element::f32, ov::Shape{3, 2}, std::vector<float>{3, 4, 2, 3, 1, 2})},
+                        "loop_reverse_concatenation")),
+        ReferenceLoopLayerTest::getTestCaseName);
+
 struct LoopStaticInputs : public LoopFunctionalBase {
     std::shared_ptr<ov::Model> create_function(const std::vector<reference_tests::Tensor>& loop_inputs,
                                                const std::vector<reference_tests::Tensor>& results,
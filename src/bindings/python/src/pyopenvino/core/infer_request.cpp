@@ -12,6 +12,7 @@
 
 #include "pyopenvino/core/common.hpp"
 #include "pyopenvino/core/containers.hpp"
+#include "pyopenvino/utils/utils.hpp"
 
 PYBIND11_MAKE_OPAQUE(Containers::TensorIndexMap);
 PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
@@ -614,6 +615,50 @@ void regclass_InferRequest(py::module m) {
             :rtype: List[openvino.runtime.VariableState]
         )");
 
+    cls.def(
+        "set_property",
+        [](InferRequestWrapper& self, const std::map<std::string, py::object>& properties) {
+            self._request.set_property(Common::utils::properties_to_any_map(properties));
+        },
+        py::arg("properties"),
+        R"(
+            Sets properties for current infer request,
+            for example openvino.runtime.properties.hint.request_priority.
+
+            :param properties: Dict of pairs: (property name, property value)
+            :type properties: dict
+            :rtype: None
+        )");
+
+    // Overload for single tuple
+    cls.def(
+        "set_property",
+        [](InferRequestWrapper& self, const std::pair<std::string, py::object>& property) {
+            ov::AnyMap _properties{{property.first, py_object_to_any(property.second)}};
+            self._request.set_property(_properties);
+        },
+        py::arg("property"),
+        R"(
+            Sets properties for current infer request.
+
+            :param property: Tuple of (property name, matching property value).
+            :type property: tuple
+        )");
+
+    cls.def(
+        "get_property",
+        [](InferRequestWrapper& self, const std::string& property) -> py::object {
+            return Common::utils::from_ov_any(self._request.get_property(property));
+        },
+        py::arg("property"),
+        R"(
+            Gets properties for current infer request.
+
+            :param name: Property name.
+            :type name: str
+            :rtype: Any
+        )");
+
     cls.def_property_readonly(
         "userdata",
         [](InferRequestWrapper& self) {
@@ -23,7 +23,11 @@ void regmodule_properties(py::module m) {
     // Submodule properties - properties
     wrap_property_RW(m_properties, ov::enable_profiling, "enable_profiling");
     wrap_property_RW(m_properties, ov::cache_dir, "cache_dir");
+    wrap_property_RW(m_properties, ov::cache_size, "cache_size");
+    wrap_property_RW(m_properties, ov::enable_mmap, "enable_mmap");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_latency_slo, "auto_batch_latency_slo");
+    wrap_property_RW(m_properties, ov::auto_batch_partial_batches, "auto_batch_partial_batches");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
@@ -38,6 +42,8 @@ void regmodule_properties(py::module m) {
     wrap_property_RO(m_properties, ov::optimal_batch_size, "optimal_batch_size");
     wrap_property_RO(m_properties, ov::max_batch_size, "max_batch_size");
     wrap_property_RO(m_properties, ov::range_for_async_infer_requests, "range_for_async_infer_requests");
+    wrap_property_RO(m_properties, ov::auto_batch_effective_timeout, "auto_batch_effective_timeout");
+    wrap_property_RO(m_properties, ov::auto_batch_fill, "auto_batch_fill");
 
     // Submodule hint
     py::module m_hint =
@@ -59,6 +65,8 @@ void regmodule_properties(py::module m) {
     // Submodule hint - properties
     wrap_property_RW(m_hint, ov::hint::inference_precision, "inference_precision");
     wrap_property_RW(m_hint, ov::hint::model_priority, "model_priority");
+    wrap_property_RW(m_hint, ov::hint::request_priority, "request_priority");
+    wrap_property_RW(m_hint, ov::hint::request_deadline, "request_deadline");
     wrap_property_RW(m_hint, ov::hint::performance_mode, "performance_mode");
     wrap_property_RW(m_hint, ov::hint::num_requests, "num_requests");
     wrap_property_RW(m_hint, ov::hint::model, "model");
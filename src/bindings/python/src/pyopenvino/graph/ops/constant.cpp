@@ -12,7 +12,10 @@
 #include <stdexcept>
 #include <vector>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/shape.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "pyopenvino/graph/ops/constant.hpp"
 
 namespace py = pybind11;
@@ -27,6 +30,24 @@ std::vector<ssize_t> _get_byte_strides(const ov::Shape& s) {
     return byte_strides;
 }
 
+// The data of the constants referring to a read-only memory mapped file (e.g. the weights of a model read from IR)
+// can't be modified in place
+static bool _is_read_only(const ov::op::v0::Constant& c) {
+    class BufferVisitor : public ov::AttributeVisitor {
+    public:
+        std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer;
+
+        void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+            if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+                buffer = a->get();
+            }
+        }
+    } visitor;
+    const_cast<ov::op::v0::Constant&>(c).visit_attributes(visitor);
+    using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+    return std::dynamic_pointer_cast<MappedBuffer>(visitor.buffer) != nullptr;
+}
+
 template <typename T>
 py::buffer_info _get_buffer_info(const ov::op::v0::Constant& c) {
     ov::Shape shape = c.get_shape();
@@ -35,7 +56,8 @@ py::buffer_info _get_buffer_info(const ov::op::v0::Constant& c) {
                            py::format_descriptor<T>::format(),               /* Python struct-style format descriptor */
                            static_cast<ssize_t>(shape.size()),               /* Number of dimensions */
                            std::vector<ssize_t>{shape.begin(), shape.end()}, /* Buffer dimensions */
-                           _get_byte_strides<T>(shape)                       /* Strides (in bytes) for each index */
+                           _get_byte_strides<T>(shape),                      /* Strides (in bytes) for each index */
+                           _is_read_only(c)                                  /* The data can't be modified */
     );
 }
 
@@ -47,7 +69,8 @@ py::buffer_info _get_buffer_info<ov::float16>(const ov::op::v0::Constant& c) {
                            std::string(1, 'H'),                              /* Python struct-style format descriptor */
                            static_cast<ssize_t>(shape.size()),               /* Number of dimensions */
                            std::vector<ssize_t>{shape.begin(), shape.end()}, /* Buffer dimensions */
-                           _get_byte_strides<ov::float16>(shape)             /* Strides (in bytes) for each index */
+                           _get_byte_strides<ov::float16>(shape),            /* Strides (in bytes) for each index */
+                           _is_read_only(c)                                  /* The data can't be modified */
     );
 }
 
@@ -12,6 +12,7 @@ import time
 import openvino.runtime.opset8 as ops
 from openvino.runtime import Core, AsyncInferQueue, Tensor, ProfilingInfo, Model
 from openvino.runtime import Type, PartialShape, Shape, Layout
+from openvino.runtime import properties
 from openvino.preprocess import PrePostProcessor
 
 # TODO: reformat into absolute paths
@@ -295,6 +296,27 @@ def test_cancel(device):
     assert "[ INFER_CANCELLED ]" in str(e.value)
 
 
+@pytest.mark.skipif(os.environ.get("TEST_DEVICE", "CPU") != "CPU",
+                    reason=f"Cannot run test on device {os.environ.get('TEST_DEVICE')}, Plugin specific test")
+def test_request_scheduling_hints(device):
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled_model = core.compile_model(model, device)
+    img = generate_image()
+    request = compiled_model.create_infer_request()
+
+    request.set_property(properties.hint.request_priority(properties.hint.Priority.HIGH))
+    request.set_property({properties.hint.request_deadline(): 100})
+    assert request.get_property(properties.hint.request_priority()) == properties.hint.Priority.HIGH
+    assert request.get_property(properties.hint.request_deadline()) == 100
+
+    res = request.infer({0: img})
+    assert len(res) == 1
+
+    with pytest.raises(RuntimeError):
+        request.set_property({properties.hint.request_deadline(): -1})
+
+
 def test_start_async(device):
     core = Core()
     model = core.read_model(test_net_xml, test_net_bin)
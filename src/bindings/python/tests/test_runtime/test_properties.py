@@ -20,6 +20,13 @@ def test_property_rw():
     assert f"Incorrect passed value: {value} , expected string values." in str(e.value)
 
 
+def test_request_hints():
+    assert properties.hint.request_priority() == "REQUEST_PRIORITY"
+    assert properties.hint.request_priority(properties.hint.Priority.LOW)[1].value == properties.hint.Priority.LOW
+    assert properties.hint.request_deadline() == "REQUEST_DEADLINE"
+    assert properties.hint.request_deadline(100)[1].value == 100
+
+
 def test_property_ro():
     assert properties.available_devices() == "AVAILABLE_DEVICES"
 
@@ -0,0 +1,41 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface HorizonReduce
+ * @brief Generated by Generator between the vector and the scalar tiles to reduce all the lanes
+ * of a Reduce accumulator into the first one
+ * @ingroup snippets
+ */
+class HorizonReduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("HorizonReduce", "SnippetsOpset");
+
+    HorizonReduce(const Output<Node>& x, Reduce::Kind kind);
+    HorizonReduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    Reduce::Kind get_kind() const { return m_kind; }
+
+protected:
+    Reduce::Kind m_kind = Reduce::Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -0,0 +1,48 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Generated by Canonicalization for ReduceSum/ReduceMax along the innermost axis. The input is accumulated into
+ * the output register over all the iterations of a tile, so the accumulator has to be reduced horizontally
+ * (see HorizonReduce) before the result is stored.
+ * @ingroup snippets
+ */
+class Reduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reduce", "SnippetsOpset");
+
+    enum class Kind {
+        Sum,
+        Max
+    };
+
+    Reduce(const Output<Node>& x, Kind kind);
+    Reduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    Kind get_kind() const { return m_kind; }
+    // the value the accumulator is initialized with
+    float get_identity() const;
+
+protected:
+    Kind m_kind = Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -101,6 +101,9 @@ public:
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ngraph::snippets::Generator> generator);
 
+    // true if the body ends with a reduction along the innermost axis, so the snippet can't be scheduled over collapsed dims
+    bool has_reduction() const;
+
     void print() const;
     void print_statistics(bool verbose);
 
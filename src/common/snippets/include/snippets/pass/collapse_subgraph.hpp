@@ -22,6 +22,7 @@ SnippetsNodeType GetSnippetsNodeType(const std::shared_ptr<const Node>&);
 void SetTopologicalOrder(const std::shared_ptr<Node>&, int64_t);
 int64_t GetTopologicalOrder(const std::shared_ptr<const Node>&);
 bool AppropriateForSubgraph(const std::shared_ptr<const Node>&);
+bool IsInnermostAxisReduction(const std::shared_ptr<const Node>&);
 
 /**
  * @interface EnumerateNodes
@@ -55,6 +56,8 @@ public:
  * New subgraph is introduced, if number of inputs and outputs exceeds 7 due to scheduling limitation
  * New subgraph is introduced, if multiple outputs of merged nodes are not broadcastable to each other (equality of all outputs is too much on the other hand)
  * Scalar constants are placed as is into subgraph due to optimization purpose
+ * ReduceSum/ReduceMax along the innermost axis (keep_dims = true) can be tokenized as well, but it always terminates a subgraph:
+ *    nothing is attached after the reduction, and the reduction must be the only output of the subgraph
  * @ingroup snippets
  */
 class TokenizeSnippets: public ngraph::pass::MatcherPass {
@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ConvertReduceToSnippetsReduce
+ * @brief Replace ReduceSum/ReduceMax along the innermost axis with snippets::op::Reduce.
+ * Must be applied before ConvertConstantsToScalars, so the reduction axes are not converted to a Scalar.
+ * @ingroup snippets
+ */
+class ConvertReduceToSnippetsReduce: public ngraph::pass::MatcherPass {
+public:
+    ConvertReduceToSnippetsReduce();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
@@ -8,10 +8,15 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/op/horizonreduce.hpp"
+#include "snippets/op/scalar.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
 
+#include <algorithm>
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
     auto rt = n->get_rt_info();
@@ -50,10 +55,25 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto out = results.size();
     auto nptrs = in + out;
 
+    // Reduce produces the result only when the whole row is processed,
+    // so its consumers are emitted once after both the vector and the scalar tiles
+    // Todo: Softmax and MVN consume the reduced value over the same row again, so they need another pair of the vector
+    //  and scalar tiles after the reduction: the input pointers are rewound by the row size, the accumulator is broadcast
+    //  to the whole vector, and MVN needs two accumulators (the mean, then the variance). It's a follow-up of
+    //  the innermost axis reductions, until then Softmax and MVN are executed by their own plugin nodes.
+    auto is_reduce_consumer = [](const std::shared_ptr<ngraph::Node>& n) {
+        const auto& inputs = n->inputs();
+        return std::any_of(inputs.begin(), inputs.end(), [](const ngraph::Input<ngraph::Node>& in) {
+            return ov::is_type<ngraph::snippets::op::Reduce>(in.get_source_output().get_node_shared_ptr());
+        });
+    };
+
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
     std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
     for (auto n : m->get_ordered_ops()) {
+        if (is_reduce_consumer(n))
+            continue;
         lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
@@ -66,8 +86,13 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
+    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> reduce_consumers;
+    std::shared_ptr<ngraph::snippets::op::Reduce> reduce;
     for (auto n : m_scalar->get_ordered_ops()) {
-        scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        if (auto r = ov::as_type_ptr<ngraph::snippets::op::Reduce>(n))
+            reduce = r;
+        auto& emitters = is_reduce_consumer(n) ? reduce_consumers : scalar_lowered;
+        emitters.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
 
@@ -82,6 +107,22 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
                     std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
 
+    // the accumulator is initialized before the vector tile and reduced to a scalar between the vector and the scalar tiles
+    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> reduce_lowered;
+    if (reduce) {
+        std::shared_ptr<ngraph::Node> reduce_node = reduce;
+        const auto accumulator = ngraph::snippets::getRegisters(reduce_node).second;
+        auto init = std::make_shared<ngraph::snippets::op::Scalar>(ngraph::element::f32, ngraph::Shape{1}, reduce->get_identity());
+        auto horizon = std::make_shared<ngraph::snippets::op::HorizonReduce>(reduce, reduce->get_kind());
+        reduce_lowered.push_back(std::make_pair(target->get(init->get_type_info())(init),
+                                                std::make_pair(std::vector<size_t>{}, accumulator)));
+        reduce_lowered.push_back(std::make_pair(target->get(horizon->get_type_info())(horizon),
+                                                std::make_pair(accumulator, accumulator)));
+        tiles1D.insert(tiles1D.begin(), reduce_lowered[0]);
+        tiles1D.insert(tiles1D.end() - 1, reduce_lowered[1]);
+        tiles1D.insert(tiles1D.end(), reduce_consumers.begin(), reduce_consumers.end());
+    }
+
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles2D;
@@ -98,6 +139,8 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     kernel->emit_code({in, out}, {});
     OV_ITT_TASK_NEXT(GENERATE, "::EmitData")
     lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
+    lowered.insert(lowered.end(), reduce_lowered.begin(), reduce_lowered.end());
+    lowered.insert(lowered.end(), reduce_consumers.begin(), reduce_consumers.end());
     for (auto& op : lowered) {
         op.first->emit_data();
     }
@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/horizonreduce.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::HorizonReduce::HorizonReduce(const Output<Node>& x, Reduce::Kind kind) : Op({x}), m_kind(kind) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::HorizonReduce::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::HorizonReduce::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(HorizonReduce);
+    check_new_args_count(this, new_args);
+    return std::make_shared<HorizonReduce>(new_args.at(0), m_kind);
+}
+
+void snippets::op::HorizonReduce::validate_and_infer_types() {
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
@@ -6,12 +6,15 @@
 #include "snippets/remarks.hpp"
 
 #include "snippets/op/subgraph.hpp"
+#include "snippets/op/reduce.hpp"
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/load_movebroadcast_to_broadcastload.hpp"
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
+#include "snippets/pass/convert_reduce_to_snippets_reduce.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
 
 #include <ngraph/pass/manager.hpp>
@@ -214,6 +217,13 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this, compatibleWithOtherOutputs, "Snippets output shapes must be numpy broadcastable");
     }
     exec_domain = outPShape.get_shape();
+    // Reduction accumulates the whole innermost dimension of its input, so it's scheduled over the input shape
+    for (const auto& op : m_body->get_ordered_ops()) {
+        if (ov::is_type<snippets::op::Reduce>(op) || snippets::pass::IsInnermostAxisReduction(op)) {
+            exec_domain = op->get_input_shape(0);
+            break;
+        }
+    }
     return exec_domain;
 }
 
@@ -224,6 +234,7 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         return n->get_input_shape(0).back() != 1;
     };
     ngraph::pass::Manager manager;
+    manager.register_pass<snippets::pass::ConvertReduceToSnippetsReduce>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
@@ -305,6 +316,13 @@ snippets::Schedule snippets::op::Subgraph::generate(ngraph::pass::Manager& opt,
     return {exec_domain, false /*canBeLinearized*/, ptr};
 }
 
+bool snippets::op::Subgraph::has_reduction() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& op) {
+        return ov::is_type<snippets::op::Reduce>(op) || snippets::pass::IsInnermostAxisReduction(op);
+    });
+}
+
 void snippets::op::Subgraph::print() const {
     INTERNAL_OP_SCOPE(Subgraph);
     remark(13) << "subgraph " << this->get_friendly_name() << " "
@@ -114,7 +114,20 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
     std::stack<Reg> bank;
     for (int i = 0; i < 16; i++) bank.push(16-1-i);
 
+    // Reduce accumulates its input over all the tile iterations, so its register is reserved for the whole snippet
+    // rather than returned to the bank and reused by the statements of the next iteration
+    std::set<int> accumulators;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        if (ov::is_type<snippets::op::Reduce>(stmts[i])) {
+            register_map[i] = bank.top();
+            bank.pop();
+            accumulators.insert(i);
+        }
+    }
+
     for (auto interval : live_intervals) {
+        if (accumulators.count(interval.first))
+            continue;
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -125,7 +138,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
+        if (active.size() == 16 - accumulators.size()) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
             register_map[interval.first] = bank.top();
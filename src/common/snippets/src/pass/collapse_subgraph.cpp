@@ -109,7 +109,8 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
         return t.get_element_type() == ngraph::element::f32 &&
                t.get_partial_shape().is_static();
     };
-    const auto & inputs = n->inputs();
+    // reduction axes are folded into snippets::op::Reduce, so only the data input is checked
+    const auto & inputs = IsInnermostAxisReduction(n) ? std::vector<Input<const Node>>{n->input(0)} : n->inputs();
     const auto & outputs = n->outputs();
     // todo: Is this check necessary? Remove if not
     for (const auto& out : outputs) {
@@ -169,8 +170,23 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 }
 } // namespace
 
+// Todo: Softmax and MVN along the innermost axis are to be tokenized as well, once the generator can emit a pass over
+//  the row that uses the reduced value (see Generator::generate)
+bool IsInnermostAxisReduction(const std::shared_ptr<const Node> &node) {
+    if (!ov::is_type<opset1::ReduceSum>(node) && !ov::is_type<opset1::ReduceMax>(node))
+        return false;
+    const auto reduce = std::dynamic_pointer_cast<const ov::op::util::ArithmeticReductionKeepDims>(node);
+    const auto& input_pshape = node->get_input_partial_shape(0);
+    if (!reduce || !reduce->get_keep_dims() || !reduce->reduction_axes_constant() || input_pshape.rank().is_dynamic())
+        return false;
+    const auto rank = input_pshape.rank().get_length();
+    // reduction of a unit dimension has nothing to accumulate
+    return rank > 0 && input_pshape[rank - 1].is_static() && input_pshape[rank - 1].get_length() > 1 &&
+           reduce->get_reduction_axes() == AxisSet{static_cast<size_t>(rank - 1)};
+}
+
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || IsInnermostAxisReduction(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -335,7 +351,9 @@ TokenizeSnippets::TokenizeSnippets() {
         assert(!cyclicDependencyIsIntoduced(node, currentTopoBounds) && "Cyclic dependency is introduced by the node itself");
         for (const auto& input_value : input_values) {
             auto input_node = input_value.get_node_shared_ptr();
+            // Reduction has to be the last node of a subgraph, since its result is available only after the whole row is processed
             if (ov::is_type<op::Subgraph>(input_node) &&
+                !ov::as_type_ptr<op::Subgraph>(input_node)->has_reduction() &&
                 !cyclicDependencyIsIntoduced(input_node, currentTopoBounds)) {
                 auto subgraph = std::static_pointer_cast<op::Subgraph>(input_node);
                 if (!input_subgraphs.count(input_node)) {
@@ -376,7 +394,8 @@ TokenizeSnippets::TokenizeSnippets() {
 
                             auto internal = input_body_parameters[i];
                             auto internal_consumers = internal->outputs();
-                            if (auto to_replace_with = ov::as_type_ptr<op::Subgraph>(subgraph->get_input_node_shared_ptr(i))) {
+                            auto to_replace_with = ov::as_type_ptr<op::Subgraph>(subgraph->get_input_node_shared_ptr(i));
+                            if (to_replace_with && !to_replace_with->has_reduction()) {
                                 // todo: In principle, we can still attach the node to the subgraph if cyclic dependency is introduced during ternary merge.
                                 //  Need to support.
                                 if (cyclicDependencyIsIntoduced(to_replace_with, currentTopoBounds))
@@ -476,6 +495,8 @@ TokenizeSnippets::TokenizeSnippets() {
         if (body_results.size() != subgraph_result_inputs.size()) {
             throw ngraph_error("body results and node results size mismatch during subgraph collaps");
         }
+        if (IsInnermostAxisReduction(node) && body_results.size() != 1)
+            return abort_with_strategy("New subgraph is created since a reduction must be the only output of a subgraph");
         // todo: move this plugin-specific constraint to the plugin callback
         if (body_parameters.size() + body_results.size() > 7) {
             const std::string message_reset = "new subgraph is created. Impossible to schedule subgraph with " +
@@ -0,0 +1,30 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/convert_reduce_to_snippets_reduce.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include <ngraph/rt_info.hpp>
+
+
+ngraph::snippets::pass::ConvertReduceToSnippetsReduce::ConvertReduceToSnippetsReduce() {
+    MATCHER_SCOPE(ConvertReduceToSnippetsReduce);
+    auto reduce = std::make_shared<pattern::op::Label>(pattern::any_input(),
+                                                    [](std::shared_ptr<Node> n) {
+                                                        return IsInnermostAxisReduction(n);
+                                                    });
+    ngraph::graph_rewrite_callback callback = [this](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ConvertReduceToSnippetsReduce")
+        auto root = m.get_match_root();
+        const auto kind = ov::is_type<ov::op::v1::ReduceMax>(root) ? snippets::op::Reduce::Kind::Max : snippets::op::Reduce::Kind::Sum;
+        auto snippets_reduce = std::make_shared<snippets::op::Reduce>(root->input(0).get_source_output(), kind);
+        snippets_reduce->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, snippets_reduce);
+        ngraph::replace_node(root, snippets_reduce);
+
+        return true;
+    };
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(reduce, matcher_name), callback);
+}
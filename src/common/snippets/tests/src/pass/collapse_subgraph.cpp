@@ -39,6 +39,13 @@ TEST_F(CollapseSubgraphTests, smoke_Snippets_AvoidLoopEltwise) {
     run();
 }
 
+TEST_F(CollapseSubgraphTests, smoke_Snippets_EltwiseReduceTerminatesSubgraph) {
+    const auto &f = EltwiseReduceFunction(std::vector<Shape> {{1, 3, 4, 16}, {1, 3, 4, 1}});
+    function = f.getOriginal();
+    function_ref = f.getReference();
+    run();
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 
 #include "ngraph/opsets/opset.hpp"
@@ -30,8 +32,17 @@ public:
      */
     Hash(uint64_t& output_hash_value);
 
+    /**
+     * @brief Hash pass constructor
+     *
+     * @param output_hash_value Reference to the 128-bit output value. By applying hash pass on function, resulting
+     * hash value will be set to this variable
+     */
+    Hash(std::array<uint64_t, 2>& output_hash_value);
+
 private:
-    uint64_t& m_hash;
+    uint64_t* m_hash = nullptr;
+    std::array<uint64_t, 2>* m_hash128 = nullptr;
 };
 
 }  // namespace pass
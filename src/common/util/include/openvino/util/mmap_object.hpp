@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief A read-only memory mapped file. The file is unmapped when the object is destroyed.
+ * The mapped memory is never modified, so the data derived from it (e.g. hashes) stays valid while it is mapped.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns the beginning of the mapped memory, `nullptr` for an empty file
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns the size of the mapped memory
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file to memory.
+ * The mapping is read-only: the pages are shared with the page cache and the other processes mapping the same file,
+ * the writes to the mapped memory fault.
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified to memory.
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -2,20 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include <dlfcn.h>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
-#include <iostream>
+#include <cerrno>
+#include <cstring>
 #include <sstream>
+#include <stdexcept>
 
-#include "mmap_object.hpp"
-#include "ngraph/runtime/shared_buffer.hpp"
-#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
+namespace util {
 
 class HandleHolder {
     int m_handle = -1;
@@ -55,7 +55,7 @@ public:
     }
 };
 
-class MapHolder {
+class MapHolder : public MappedMemory {
     void* m_data = MAP_FAILED;
     size_t m_size = 0;
     HandleHolder m_handle;
@@ -68,15 +68,21 @@ public:
         int mode = O_RDONLY;
         struct stat sb = {};
         m_handle = HandleHolder(open(path.c_str(), mode));
-        OPENVINO_ASSERT(m_handle.get() != -1,
-                        "Can not open file ",
-                        path,
-                        " for mapping. Ensure that file exists and has appropriate permissions");
-        OPENVINO_ASSERT(fstat(m_handle.get(), &sb) != -1, "Can not get file size for ", path);
+        if (m_handle.get() == -1) {
+            throw std::runtime_error("Can not open file " + path +
+                                     " for mapping. Ensure that file exists and has appropriate permissions");
+        }
+        if (fstat(m_handle.get(), &sb) == -1) {
+            throw std::runtime_error("Can not get file size for " + path);
+        }
         m_size = sb.st_size;
         if (m_size > 0) {
             m_data = mmap(nullptr, m_size, prot, MAP_PRIVATE, m_handle.get(), 0);
-            OPENVINO_ASSERT(m_data != MAP_FAILED, "Can not create file mapping for ", path, ", err=", strerror(errno));
+            if (m_data == MAP_FAILED) {
+                std::stringstream ss;
+                ss << "Can not create file mapping for " << path << ", err=" << std::strerror(errno);
+                throw std::runtime_error(ss.str());
+            }
         } else {
             m_data = MAP_FAILED;
         }
@@ -88,21 +94,20 @@ public:
         }
     }
 
-    char* data() noexcept {
-        return static_cast<char*>(m_data);
+    char* data() noexcept override {
+        return m_data != MAP_FAILED ? static_cast<char*>(m_data) : nullptr;
     }
 
-    size_t size() const noexcept {
+    size_t size() const noexcept override {
         return m_size;
     }
 };
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
     auto holder = std::make_shared<MapHolder>();
     holder->set(path);
-    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
-                                                                                       holder->size(),
-                                                                                       holder);
+    return holder;
 }
 
+}  // namespace util
 }  // namespace ov
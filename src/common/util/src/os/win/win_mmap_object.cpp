@@ -2,15 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include "mmap_object.hpp"
-#include "ngraph/runtime/shared_buffer.hpp"
+#include <stdexcept>
+
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 // clang-format-off
 #include <windows.h>
 // clang-format-on
 
 namespace ov {
+namespace util {
 
 class HandleHolder {
     HANDLE m_handle = INVALID_HANDLE_VALUE;
@@ -47,7 +49,7 @@ public:
     }
 };
 
-class MapHolder {
+class MapHolder : public MappedMemory {
 public:
     MapHolder() = default;
 
@@ -69,43 +71,48 @@ public:
     }
 #endif
 
-    char* data() noexcept {
+    char* data() noexcept override {
         return static_cast<char*>(m_data);
     }
-    size_t size() const noexcept {
+    size_t size() const noexcept override {
         return m_size;
     }
 
 private:
     void map(const std::string& path, HANDLE h) {
-        OPENVINO_ASSERT(h != INVALID_HANDLE_VALUE,
-                        "Can not open file ",
-                        path,
-                        " for mapping. Ensure that file exists and has appropriate permissions");
+        if (h == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Can not open file " + path +
+                                     " for mapping. Ensure that file exists and has appropriate permissions");
+        }
         m_handle = HandleHolder(h);
         SYSTEM_INFO SystemInfo;
         GetSystemInfo(&SystemInfo);
         const int64_t page_size = SystemInfo.dwAllocationGranularity;
 
-        DWORD file_mode = GENERIC_READ;
         DWORD map_mode = FILE_MAP_READ;
         DWORD access = PAGE_READONLY;
 
         LARGE_INTEGER file_size_large;
-        OPENVINO_ASSERT(::GetFileSizeEx(m_handle.get(), &file_size_large) != 0, "Can not get file size for ", path);
+        if (::GetFileSizeEx(m_handle.get(), &file_size_large) == 0) {
+            throw std::runtime_error("Can not get file size for " + path);
+        }
 
         m_size = static_cast<uint64_t>(file_size_large.QuadPart);
         if (m_size > 0) {
             m_mapping =
                 HandleHolder(::CreateFileMapping(m_handle.get(), 0, access, m_size >> 32, m_size & 0xffffffff, 0));
-            OPENVINO_ASSERT(m_mapping.get() != INVALID_HANDLE_VALUE, "Can not create file mapping for ", path);
+            if (m_mapping.get() == NULL || m_mapping.get() == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("Can not create file mapping for " + path);
+            }
 
             m_data = ::MapViewOfFile(m_mapping.get(),
                                      map_mode,
                                      0,  // offset_align >> 32,
                                      0,  // offset_align & 0xffffffff,
                                      m_size);
-            OPENVINO_ASSERT(m_data, "Can not create map view for ", path);
+            if (m_data == NULL) {
+                throw std::runtime_error("Can not create map view for " + path);
+            }
         } else {
             m_data = NULL;
         }
@@ -118,24 +125,21 @@ private:
     HandleHolder m_mapping;
 };
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
     auto holder = std::make_shared<MapHolder>();
     holder->set(path);
-    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
-                                                                                       holder->size(),
-                                                                                       holder);
+    return holder;
 }
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
     auto holder = std::make_shared<MapHolder>();
     holder->set(path);
-    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
-                                                                                       holder->size(),
-                                                                                       holder);
+    return holder;
 }
 
 #endif
 
+}  // namespace util
 }  // namespace ov
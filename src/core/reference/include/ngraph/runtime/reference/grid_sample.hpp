@@ -111,8 +111,9 @@ DATA_ET reflection_data_with_align(const DATA_ET* data,
     const auto W = static_cast<long>(data_shape[3]);
     const auto H_2_2 = 2 * (H - 1);
     const auto W_2_2 = 2 * (W - 1);
-    y_d = std::abs(y_d) % H_2_2;
-    x_d = std::abs(x_d) % W_2_2;
+    // the single element dimension reflects into itself (and its period is zero)
+    y_d = H == 1 ? 0 : std::abs(y_d) % H_2_2;
+    x_d = W == 1 ? 0 : std::abs(x_d) % W_2_2;
     const auto y = static_cast<size_t>(y_d >= H ? H_2_2 - y_d : y_d);
     const auto x = static_cast<size_t>(x_d >= W ? W_2_2 - x_d : x_d);
     return get_single_value(data, data_shape, index_4D_t{n, c, y, x});
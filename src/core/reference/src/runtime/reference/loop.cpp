@@ -4,6 +4,8 @@
 
 #include "ngraph/runtime/reference/loop.hpp"
 
+#include <algorithm>
+
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/function.hpp"
 #include "ngraph/runtime/reference/split.hpp"
@@ -189,6 +191,10 @@ void loop(const std::shared_ptr<Function>& func,
             for (const auto& vec : values_to_concat[i]) {
                 pointers_on_values.push_back(vec->get_data_ptr<char>());
             }
+            // the negative stride concatenates the iterations in the reverse order
+            if (concat_desc->m_stride < 0) {
+                std::reverse(pointers_on_values.begin(), pointers_on_values.end());
+            }
             reference::concat(pointers_on_values,
                               out[concat_desc->m_output_index]->get_data_ptr<char>(),
                               shapes_to_concat,
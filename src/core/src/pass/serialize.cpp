@@ -4,20 +4,27 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <ngraph/variant.hpp>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "ie_parallel.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/opsets/opset1.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/constant_folding.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -88,6 +95,12 @@ public:
           m_enable_compression(enable_compression),
           m_blob_offset(bin_data.tellp()) {}
 
+    virtual ~ConstantWriter() = default;
+
+    virtual FilePosition write(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        return write(buffer->get_ptr<char>(), buffer->size());
+    }
+
     FilePosition write(const char* ptr, size_t size) {
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
@@ -422,7 +435,7 @@ public:
                            &adapter)) {
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                int64_t offset = m_constant_write_handler.write(a->get());
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
@@ -979,7 +992,7 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
 }
 
 void serializeFunc(std::ostream& xml_file,
-                   std::ostream& bin_file,
+                   ConstantWriter& constant_write_handler,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
@@ -1004,15 +1017,24 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
     xml_doc.save(xml_file);
     xml_file.flush();
-    bin_file.flush();
 };
 
+void serializeFunc(std::ostream& xml_file,
+                   std::ostream& bin_file,
+                   std::shared_ptr<ov::Model> f,
+                   ov::pass::Serialize::Version ver,
+                   const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                   bool deterministic = false) {
+    ConstantWriter constant_write_handler(bin_file);
+    serializeFunc(xml_file, constant_write_handler, f, ver, custom_opsets, deterministic);
+    bin_file.flush();
+}
+
 }  // namespace
 
 namespace ov {
@@ -1168,36 +1190,277 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
 /// -------- Hash calculation pass -------------
 
 namespace {
-template <typename T>
-static uint64_t hash_combine(uint64_t seed, const T& a) {
-    // Hash combine formula from boost
-    return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
-}
+using Hash128 = std::array<uint64_t, 2>;
+
+// Streaming version of the MurmurHash3 x64 128-bit hash, the result doesn't depend on how the data is split into
+// chunks
+class Hasher128 {
+    static constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+    static constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+    static constexpr size_t block_size = 2 * sizeof(uint64_t);
+
+    uint64_t m_h1 = 0;
+    uint64_t m_h2 = 0;
+    uint64_t m_size = 0;
+    char m_tail[block_size] = {};
+
+    static uint64_t rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static uint64_t fmix(uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    static uint64_t mix_k1(uint64_t k1) {
+        return rotl(k1 * c1, 31) * c2;
+    }
+
+    static uint64_t mix_k2(uint64_t k2) {
+        return rotl(k2 * c2, 33) * c1;
+    }
+
+    void process_block(const char* data) {
+        uint64_t k[2];
+        std::memcpy(k, data, block_size);
+        m_h1 ^= mix_k1(k[0]);
+        m_h1 = (rotl(m_h1, 27) + m_h2) * 5 + 0x52dce729;
+        m_h2 ^= mix_k2(k[1]);
+        m_h2 = (rotl(m_h2, 31) + m_h1) * 5 + 0x38495ab5;
+    }
+
+public:
+    void update(const char* data, size_t size) {
+        size_t tail_size = m_size % block_size;
+        m_size += size;
+        if (tail_size) {
+            const auto n = std::min(size, block_size - tail_size);
+            std::memcpy(m_tail + tail_size, data, n);
+            data += n;
+            size -= n;
+            if (tail_size + n < block_size) {
+                return;
+            }
+            process_block(m_tail);
+        }
+        for (; size >= block_size; data += block_size, size -= block_size) {
+            process_block(data);
+        }
+        std::memcpy(m_tail, data, size);
+    }
+
+    uint64_t size() const {
+        return m_size;
+    }
+
+    Hash128 get() const {
+        uint64_t h1 = m_h1, h2 = m_h2;
+        const auto tail_size = m_size % block_size;
+        uint64_t k[2] = {0, 0};
+        std::memcpy(k, m_tail, tail_size);
+        if (tail_size > sizeof(uint64_t)) {
+            h2 ^= mix_k2(k[1]);
+        }
+        if (tail_size > 0) {
+            h1 ^= mix_k1(k[0]);
+        }
+        h1 ^= m_size;
+        h2 ^= m_size;
+        h1 += h2;
+        h2 += h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        h1 += h2;
+        h2 += h1;
+        return {h1, h2};
+    }
+};
 
 class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
+    Hasher128 m_hasher;
 
 public:
-    uint64_t getResult() const {
-        return m_res;
+    Hash128 getResult() const {
+        return m_hasher.get();
     }
 
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+        m_hasher.update(s, static_cast<size_t>(n));
+        return n;
+    }
+
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char ch = traits_type::to_char_type(c);
+            m_hasher.update(&ch, 1);
         }
+        return traits_type::not_eof(c);
+    }
 
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+    // tellp() reports the number of bytes written, it is used for the constants offsets
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::out)) {
+            return pos_type(off_type(-1));
         }
-        return n;
+        return pos_type(static_cast<off_type>(m_hasher.size()));
     }
 };
+
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
+// The data of a read-only memory mapped file never changes while it is mapped. Any other constant data may be modified
+// in place, e.g. through the Python buffer protocol, so its hash can't be reused by the next calculation
+bool is_read_only(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    return dynamic_cast<const MappedBuffer*>(buffer.get()) != nullptr;
+}
+
+/**
+ * Hashes of the read-only constants data memoized by the buffers.
+ * An entry refers to its buffer weakly: it doesn't prolong the buffer lifetime and is not used for another buffer
+ * allocated at the same address.
+ */
+class BufferHashCache {
+    struct Entry {
+        std::weak_ptr<ngraph::runtime::AlignedBuffer> buffer;
+        Hash128 hash;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const ngraph::runtime::AlignedBuffer*, Entry> m_entries;
+    size_t m_prune_size = 1024;
+
+public:
+    static BufferHashCache& get() {
+        static BufferHashCache cache;
+        return cache;
+    }
+
+    bool find(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer, Hash128& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_entries.find(buffer.get());
+        if (found == m_entries.end() || found->second.buffer.lock() != buffer) {
+            return false;
+        }
+        hash = found->second.hash;
+        return true;
+    }
+
+    void insert(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer, const Hash128& hash) {
+        assert(is_read_only(buffer));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[buffer.get()] = {buffer, hash};
+        if (m_entries.size() >= m_prune_size) {
+            // drop the entries of the released buffers
+            for (auto it = m_entries.begin(); it != m_entries.end();) {
+                it = it->second.buffer.expired() ? m_entries.erase(it) : std::next(it);
+            }
+            m_prune_size = std::max<size_t>(1024, 2 * m_entries.size());
+        }
+    }
+};
+
+using BufferHashes = std::unordered_map<const ngraph::runtime::AlignedBuffer*, Hash128>;
+
+Hash128 hash_buffer(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    Hasher128 hasher;
+    hasher.update(buffer->get_ptr<char>(), buffer->size());
+    return hasher.get();
+}
+
+// Writes the hash of the constant data instead of the data itself
+class ConstantHashWriter final : public ConstantWriter {
+    const BufferHashes& m_hashes;
+
+public:
+    ConstantHashWriter(std::ostream& bin_data, const BufferHashes& hashes)
+        : ConstantWriter(bin_data, false),
+          m_hashes(hashes) {}
+
+    FilePosition write(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) override {
+        const auto found = m_hashes.find(buffer.get());
+        const auto hash = found != m_hashes.end() ? found->second : hash_buffer(buffer);
+        return ConstantWriter::write(reinterpret_cast<const char*>(hash.data()), sizeof(hash));
+    }
+};
+
+class ConstantBuffersCollector : public ngraph::AttributeVisitor {
+public:
+    std::vector<std::shared_ptr<ngraph::runtime::AlignedBuffer>> buffers;
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a =
+                ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            if (a->get()) {
+                buffers.push_back(a->get());
+            }
+        }
+    }
+};
+
+void collect_constant_buffers(const std::shared_ptr<ov::Model>& f, ConstantBuffersCollector& collector) {
+    for (const auto& node : f->get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::Constant>(node)) {
+            node->visit_attributes(collector);
+        } else if (const auto& subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < subgraph->get_internal_subgraphs_size(); ++i) {
+                if (const auto& body = subgraph->get_function(static_cast<int>(i))) {
+                    collect_constant_buffers(body, collector);
+                }
+            }
+        }
+    }
+}
+
+// Hashes the constants of the model in parallel, the hashes of the read-only constants are memoized
+BufferHashes compute_constant_hashes(const std::shared_ptr<ov::Model>& f) {
+    // smaller amount of data is hashed faster than the parallel tasks are scheduled
+    constexpr size_t min_parallel_bytes = 16 * 1024 * 1024;
+
+    ConstantBuffersCollector collector;
+    collect_constant_buffers(f, collector);
+
+    auto& cache = BufferHashCache::get();
+    BufferHashes hashes;
+    std::vector<std::shared_ptr<ngraph::runtime::AlignedBuffer>> missing;
+    size_t missing_bytes = 0;
+    for (const auto& buffer : collector.buffers) {
+        Hash128 hash;
+        if (hashes.count(buffer.get())) {
+            continue;
+        }
+        if (is_read_only(buffer) && cache.find(buffer, hash)) {
+            hashes.emplace(buffer.get(), hash);
+            continue;
+        }
+        hashes.emplace(buffer.get(), Hash128{});
+        missing.push_back(buffer);
+        missing_bytes += buffer->size();
+    }
+
+    std::vector<Hash128> missing_hashes(missing.size());
+    if (missing.size() > 1 && missing_bytes >= min_parallel_bytes) {
+        InferenceEngine::parallel_for(missing.size(), [&](size_t i) {
+            missing_hashes[i] = hash_buffer(missing[i]);
+        });
+    } else {
+        for (size_t i = 0; i < missing.size(); ++i) {
+            missing_hashes[i] = hash_buffer(missing[i]);
+        }
+    }
+
+    for (size_t i = 0; i < missing.size(); ++i) {
+        hashes[missing[i].get()] = missing_hashes[i];
+        if (is_read_only(missing[i])) {
+            cache.insert(missing[i], missing_hashes[i]);
+        }
+    }
+    return hashes;
+}
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
@@ -1207,18 +1470,31 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
+    // The constants are hashed once per buffer, the serialized model refers to the hashes of their data
+    const auto constant_hashes = compute_constant_hashes(f);
+    ConstantHashWriter constant_write_handler(bin, constant_hashes);
+
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, constant_write_handler, f, Serialize::Version::UNSPECIFIED, {}, true);
 
-    uint64_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    Hasher128 hasher;
+    for (const auto& hash : {xmlHash.getResult(), binHash.getResult()}) {
+        hasher.update(reinterpret_cast<const char*>(hash.data()), sizeof(hash));
+    }
+    const auto hash = hasher.get();
 
-    m_hash = seed;
+    if (m_hash128) {
+        *m_hash128 = hash;
+    }
+    if (m_hash) {
+        *m_hash = hash[0] ^ hash[1];
+    }
     // Return false because we didn't change nGraph Function
     return false;
 }
 
-pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
+pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(&output_hash_value) {}
+
+pass::Hash::Hash(std::array<uint64_t, 2>& output_hash_value) : m_hash128(&output_hash_value) {}
 
 }  // namespace ov
@@ -8,11 +8,11 @@
 #include <vector>
 
 #include "input_model.hpp"
-#include "mmap_object.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
@@ -163,10 +163,15 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         provided_model_stream = model_variant.as<std::istringstream*>();
     }
 
+    // the weights file is memory mapped unless it is disabled explicitly
+    bool enable_mmap = true;
+
     // Check weights and extensions
     for (size_t variant_id = 1; variant_id < variants.size(); ++variant_id) {
         const auto& variant = variants.at(variant_id);
-        if (variant.is<std::string>()) {
+        if (variant.is<bool>()) {
+            enable_mmap = variant.as<bool>();
+        } else if (variant.is<std::string>()) {
             const auto& tmp_path = variant.as<std::string>();
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
             weights_path = ov::util::string_to_wstring(tmp_path.c_str());
@@ -197,7 +202,15 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             weights_path.clear();
         }
     }
-    if (!weights_path.empty()) {
+    if (!weights_path.empty() && enable_mmap) {
+        // the constants refer to the mapped memory directly, the pages are loaded on demand and are shared with the
+        // other processes reading the same file
+        auto mapped = ov::util::load_mmap_object(weights_path);
+        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped->data(),
+            mapped->size(),
+            mapped);
+    } else if (!weights_path.empty()) {
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
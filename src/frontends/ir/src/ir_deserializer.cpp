@@ -4,9 +4,12 @@
 
 #include "ir_deserializer.hpp"
 
+#include <exception>
 #include <pugixml.hpp>
+#include <vector>
 
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "rt_info_deserializer.hpp"
@@ -16,6 +19,36 @@
 
 using namespace ov;
 
+namespace {
+// The smaller amounts of work are not worth to be distributed between the threads
+constexpr size_t min_parallel_work_amount = 64;
+
+/// \brief Calls func for the indices [0, work_amount) in parallel. The exception thrown for the smallest index is
+/// rethrown in the calling thread, so the reported error is the same as for the sequential processing.
+template <typename F>
+void parallel_run(size_t work_amount, const F& func) {
+    if (work_amount < min_parallel_work_amount) {
+        for (size_t i = 0; i < work_amount; ++i) {
+            func(i);
+        }
+        return;
+    }
+    std::vector<std::exception_ptr> errors(work_amount);
+    InferenceEngine::parallel_for(work_amount, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -399,6 +432,20 @@ void XmlDeserializer::on_adapter(const std::string& name,
     adapter.set(ngraph_function);
 }
 
+// Symmetric function to translate type name.
+// See translate_type_name in src/core/src/pass/serialize.cpp.
+static const std::string& translate_type_name(const std::string& name) {
+    static const std::unordered_map<std::string, std::string> translate_type_name_translator = {{"Const", "Constant"},
+                                                                                                {"PReLU", "PRelu"},
+                                                                                                {"ReLU", "Relu"},
+                                                                                                {"SoftMax", "Softmax"}};
+    auto found = translate_type_name_translator.find(name);
+    if (found != end(translate_type_name_translator)) {
+        return found->second;
+    }
+    return name;
+}
+
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root,
     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
@@ -427,9 +474,18 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    // Parse the layers in parallel, the layers don't depend on each other
+    std::vector<pugi::xml_node> layer_nodes;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layer_nodes.emplace_back(node); }
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    parallel_run(layer_nodes.size(), [&](size_t i) {
+        layer_params[i] = parseGenericParams(layer_nodes[i]);
+    });
+
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    for (size_t i = 0; i < layer_nodes.size(); ++i) {
+        const auto& node = layer_nodes[i];
+        const auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
@@ -456,16 +512,24 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     }
 
     // Run DFS starting from outputs to get nodes topological order
-    std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
-        if (dfs_used_nodes.count(id))
-            return;
-        dfs_used_nodes.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    // The stack is explicit as the recursion depth would be the length of the longest path in the graph
+    for (const auto& output : outputs) {
+        if (!dfs_used_nodes.insert(output).second)
+            continue;
+        std::vector<std::pair<size_t /*layer-id*/, size_t /*next edge*/>> dfs_stack{{output, 0}};
+        while (!dfs_stack.empty()) {
+            const auto id = dfs_stack.back().first;
+            const auto& id_edges = edges[id];
+            if (dfs_stack.back().second < id_edges.size()) {
+                const auto from_id = id_edges[dfs_stack.back().second++].fromLayerId;
+                if (dfs_used_nodes.insert(from_id).second)
+                    dfs_stack.emplace_back(from_id, 0);
+            } else {
+                order.push_back(id);
+                dfs_stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
@@ -473,28 +537,50 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // Constants don't depend on the other nodes, so they are created in parallel in advance. The other nodes need
+    // the types of their inputs and modify the inputs consumers, they are created sequentially below.
+    std::vector<size_t> constant_ids;
+    for (const auto& layer_id : order) {
+        const auto& p = params[layer_id].params;
+        const auto& edgeIt = edges.find(layer_id);
+        if (edgeIt != edges.end() && edgeIt->second.empty() && translate_type_name(p.type) == "Constant" &&
+            !m_extensions.count(ov::DiscreteTypeInfo("Constant", 0, p.version.c_str()))) {
+            constant_ids.push_back(layer_id);
+        }
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> constants(constant_ids.size());
+    parallel_run(constant_ids.size(), [&](size_t i) {
+        const auto& p = params.at(constant_ids[i]);
+        constants[i] = createNode({}, p.xml, weights, p.params);
+    });
+    for (size_t i = 0; i < constant_ids.size(); ++i) {
+        id_to_node[constant_ids[i]] = constants[i];
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
-        ngraph::OutputVector inputs(edgeIt->second.size());
-        for (auto& e : edgeIt->second) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+        auto& node = id_to_node[layer_id];
+        if (!node) {
+            ngraph::OutputVector inputs(edgeIt->second.size());
+            for (auto& e : edgeIt->second) {
+                auto input_node = id_to_node[e.fromLayerId];
+                if (!input_node) {
+                    IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+                }
+                auto& p_output = params[e.fromLayerId].params;
+                size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
+                if (realInputPortId >= inputs.size())
+                    IE_THROW() << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
+                               << " is inconsistent!";
+                inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
             }
-            auto& p_output = params[e.fromLayerId].params;
-            size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
-            if (realInputPortId >= inputs.size())
-                IE_THROW() << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
-                           << " is inconsistent!";
-            inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+            node = createNode(inputs, p.xml, weights, p.params);
+        }
 
         // Check that output shape after OpenVINO node validation the same as in IR
         // because IR always right!
@@ -608,20 +694,6 @@ GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& nod
     return params;
 }
 
-// Symmetric function to translate type name.
-// See translate_type_name in src/core/src/pass/serialize.cpp.
-static const std::string& translate_type_name(const std::string& name) {
-    static const std::unordered_map<std::string, std::string> translate_type_name_translator = {{"Const", "Constant"},
-                                                                                                {"PReLU", "PRelu"},
-                                                                                                {"ReLU", "Relu"},
-                                                                                                {"SoftMax", "Softmax"}};
-    auto found = translate_type_name_translator.find(name);
-    if (found != end(translate_type_name_translator)) {
-        return found->second;
-    }
-    return name;
-}
-
 std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
     const std::vector<ngraph::Output<ngraph::Node>>& inputs,
     const pugi::xml_node& node,
@@ -16,13 +16,16 @@
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
 #include "openvino/frontend/extension/holder.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph {
 namespace onnx_import {
 class Graph : public std::enable_shared_from_this<Graph> {
 public:
+    /// \param enable_mmap  The external data files are memory mapped if true, read to memory otherwise
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
-          ov::frontend::ExtensionHolder extensions = {});
+          ov::frontend::ExtensionHolder extensions = {},
+          bool enable_mmap = true);
     Graph() = delete;
 
     Graph(const Graph&) = delete;
@@ -49,10 +52,16 @@ public:
         return m_extensions;
     }
 
+    /// \brief      The external data files mapped by the graph, nullptr if memory mapping is disabled
+    const detail::MappedMemoryHandles& get_mmap_cache() const {
+        return m_mmap_cache;
+    }
+
 protected:
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
-          ov::frontend::ExtensionHolder extensions = {});
+          ov::frontend::ExtensionHolder extensions = {},
+          detail::MappedMemoryHandles mmap_cache = nullptr);
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
 
@@ -67,6 +76,8 @@ protected:
     std::unique_ptr<Model> m_model;
     std::unique_ptr<GraphCache> m_cache;
     ov::frontend::ExtensionHolder m_extensions = {};
+    // each external data file is mapped once for all the initializers of the graph and its subgraphs
+    detail::MappedMemoryHandles m_mmap_cache;
 
 private:
     std::vector<Node> m_nodes;
@@ -10,7 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "exceptions.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -355,9 +357,10 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
-          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
+          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -443,6 +446,12 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        // the external data is read to memory if memory mapping is disabled (no cache of the mapped files)
+        if (m_mmap_cache && detail::has_tensor_external_data(*m_tensor_proto)) {
+            if (auto constant = make_external_ng_constant(get_ng_type())) {
+                return constant;
+            }
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -476,6 +485,22 @@ public:
     }
 
 private:
+    // The external data is stored in the same format for all the types, the constant refers to the mapped file.
+    // Returns nullptr if the data has to be read to memory: the file can't be mapped or its offset is not aligned.
+    std::shared_ptr<ngraph::op::Constant> make_external_ng_constant(const element::Type& type) const {
+        const auto external_data = detail::TensorExternalData(*m_tensor_proto);
+        const auto buffer = external_data.load_external_mmap_data(*m_mmap_cache, shape_size(m_shape) * type.size());
+        if (!buffer || reinterpret_cast<uintptr_t>(buffer->get_ptr()) % type.size() != 0) {
+            return nullptr;
+        }
+
+        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T,
               typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value ||
                                           std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
@@ -484,10 +509,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         int data_size = detail::get_data_size(*m_tensor_proto);
-        if (detail::has_tensor_external_data(*m_tensor_proto)) {
-            auto external_data = detail::load_external_data(*m_tensor_proto);
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, detail::get_data_ptr(*m_tensor_proto));
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -525,6 +547,7 @@ private:
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
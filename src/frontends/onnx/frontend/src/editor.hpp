@@ -31,9 +31,10 @@ public:
     ///        is parsed and loaded into the m_model_proto member variable.
     ///
     /// \param model_path Path to the file containing the model.
-    ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions = {});
+    /// \param enable_mmap The external data files are memory mapped if true, read to memory otherwise.
+    ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions = {}, bool enable_mmap = true);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    ONNXModelEditor(const std::wstring& model_path, frontend::ExtensionHolder extensions = {});
+    ONNXModelEditor(const std::wstring& model_path, frontend::ExtensionHolder extensions = {}, bool enable_mmap = true);
 #endif
 
     /// \brief Creates an editor from a model stream. The stream is parsed and loaded
@@ -42,9 +43,11 @@ public:
     /// \param model_stream The stream containing the model.
     /// \param model_path Path to the file containing the model. This information can be used
     ///                   for ONNX external weights feature support.
+    /// \param enable_mmap The external data files are memory mapped if true, read to memory otherwise.
     ONNXModelEditor(std::istream& model_stream,
                     const std::string& path = "",
-                    frontend::ExtensionHolder extensions = {});
+                    frontend::ExtensionHolder extensions = {},
+                    bool enable_mmap = true);
 
     /// \brief Modifies the in-memory representation of the model by setting
     ///        custom input types for all inputs specified in the provided map.
@@ -298,6 +301,7 @@ private:
 
     frontend::ExtensionHolder m_extensions;
     const std::string m_model_path;
+    const bool m_enable_mmap;
 
     struct Impl;
     std::unique_ptr<Impl, void (*)(Impl*)> m_pimpl;
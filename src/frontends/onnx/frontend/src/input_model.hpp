@@ -16,16 +16,23 @@ namespace onnx {
 
 class InputModel : public ov::frontend::InputModel {
 public:
-    InputModel(const std::string& path, ExtensionHolder extensions = {});
+    // The external data files are memory mapped unless enable_mmap is false
+    InputModel(const std::string& path, ExtensionHolder extensions = {}, bool enable_mmap = true);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    InputModel(const std::wstring& path, ExtensionHolder extensions = {});
+    InputModel(const std::wstring& path, ExtensionHolder extensions = {}, bool enable_mmap = true);
 #endif
     InputModel(std::istream& model_stream, ExtensionHolder extensions = {});
     // The path can be required even if the model is passed as a stream because it is necessary
     // for ONNX external data feature
-    InputModel(std::istream& model_stream, const std::string& path, ExtensionHolder extensions = {});
+    InputModel(std::istream& model_stream,
+               const std::string& path,
+               ExtensionHolder extensions = {},
+               bool enable_mmap = true);
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    InputModel(std::istream& model_stream, const std::wstring& path, ExtensionHolder extensions = {});
+    InputModel(std::istream& model_stream,
+               const std::wstring& path,
+               ExtensionHolder extensions = {},
+               bool enable_mmap = true);
 #endif
 
     std::vector<ov::frontend::Place::Ptr> get_inputs() const override;
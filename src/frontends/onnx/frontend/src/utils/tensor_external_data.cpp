@@ -10,7 +10,9 @@
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -46,12 +48,6 @@ std::string TensorExternalData::load_external_data() const {
     else
         read_data_length = m_data_length;
 
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
     // default value of m_offset is 0
     external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -67,6 +63,33 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+std::shared_ptr<MappedBuffer> TensorExternalData::load_external_mmap_data(MappedMemoryHandles::element_type& cache,
+                                                                        size_t data_size) const {
+    std::shared_ptr<ov::util::MappedMemory> mapped_file;
+    const auto it = cache.find(m_data_location);
+    if (it != cache.end()) {
+        mapped_file = it->second;
+    } else {
+        try {
+            mapped_file = ov::util::load_mmap_object(m_data_location);
+        } catch (...) {
+            // the file can't be mapped (e.g. unicode path on Windows), the regular reading reports the errors
+            return nullptr;
+        }
+        cache.emplace(m_data_location, mapped_file);
+    }
+
+    const auto file_size = mapped_file->size();
+    if (m_offset < 0 || m_data_length < 0 || (m_data_length != 0 && static_cast<size_t>(m_data_length) < data_size) ||
+        static_cast<size_t>(m_offset) > file_size || data_size > file_size - m_offset) {
+        throw error::invalid_external_data{*this};
+    }
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+    return std::make_shared<MappedBuffer>(mapped_file->data() + m_offset, data_size, mapped_file);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -6,9 +6,22 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Memory mapped external data files (by location) shared between the tensors
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
+/// \brief  Tensor data referring to a memory mapped file, the buffer keeps the mapping alive
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +36,20 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map the external data file to memory and return the tensor data region
+    ///
+    /// \note       If the data region doesn't fit in the file,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      cache      The files mapped already, the new mappings are added to it.
+    /// \param      data_size  The size of the tensor data in bytes, the length stored in the model
+    ///                        can't be smaller.
+    ///
+    /// \return     Buffer of data_size bytes referring to the mapped file,
+    ///             nullptr if the file can't be memory mapped
+    std::shared_ptr<MappedBuffer> load_external_mmap_data(MappedMemoryHandles::element_type& cache,
+                                                          size_t data_size) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -4,12 +4,15 @@
 
 #include "common_test_utils/file_utils.hpp"
 #include "default_opset.hpp"
+#include "editor.hpp"
 #include "engines_util/test_case.hpp"
 #include "engines_util/test_engines.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_import/onnx.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
 #include "util/type_prop.hpp"
@@ -23,6 +26,34 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 static std::string s_manifest = "${MANIFEST}";
 static std::string s_device = test::backend_name_to_device("${BACKEND_NAME}");
 
+namespace {
+std::shared_ptr<default_opset::Constant> get_constant(const std::shared_ptr<Function>& function,
+                                                      const std::string& name) {
+    for (const auto& op : function->get_ops()) {
+        if (op->get_friendly_name() == name) {
+            return ov::as_type_ptr<default_opset::Constant>(op);
+        }
+    }
+    return nullptr;
+}
+
+bool is_memory_mapped(const std::shared_ptr<default_opset::Constant>& constant) {
+    class BufferVisitor : public ov::AttributeVisitor {
+    public:
+        std::shared_ptr<runtime::AlignedBuffer> buffer;
+
+        void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+            if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>>(&adapter)) {
+                buffer = a->get();
+            }
+        }
+    } visitor;
+    constant->visit_attributes(visitor);
+    using MappedBuffer = runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+    return std::dynamic_pointer_cast<MappedBuffer>(visitor.buffer) != nullptr;
+}
+}  // namespace
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data) {
     const auto function = onnx_import::import_onnx_model(file_util::path_join(CommonTestUtils::getExecutableDirectory(),
                                                                               SERIALIZED_ZOO,
@@ -93,6 +124,47 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_mapped_once) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    const auto data_a = get_constant(function, "data_a");
+    const auto data_b = get_constant(function, "data_b");
+    ASSERT_NE(nullptr, data_a);
+    ASSERT_NE(nullptr, data_b);
+    // the constants refer to the same mapping of the file at the offsets of the tensors, the data is not copied
+    EXPECT_TRUE(is_memory_mapped(data_a));
+    EXPECT_TRUE(is_memory_mapped(data_b));
+    EXPECT_EQ(4096, data_b->get_data_ptr<char>() - data_a->get_data_ptr<char>());
+    EXPECT_EQ(12u, data_a->get_byte_size());
+    EXPECT_EQ((std::vector<int32_t>{1, 2, 3}), data_b->cast_vector<int32_t>());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_mmap_disabled) {
+    ov::onnx_editor::ONNXModelEditor editor{
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"),
+        {},
+        false};
+    const auto function = editor.get_function();
+
+    const auto data_a = get_constant(function, "data_a");
+    const auto data_b = get_constant(function, "data_b");
+    ASSERT_NE(nullptr, data_a);
+    ASSERT_NE(nullptr, data_b);
+    // the data is read to memory
+    EXPECT_FALSE(is_memory_mapped(data_a));
+    EXPECT_FALSE(is_memory_mapped(data_b));
+
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<int32_t>({2, 3, 1});
+    test_case.add_expected_output<int32_t>({3, 3, 3});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -138,3 +210,32 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path) {
 
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_unaligned_offset) {
+    const auto function =
+        onnx_import::import_onnx_model(file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                                            SERIALIZED_ZOO,
+                                                            "onnx/external_data/external_data_unaligned_offset.onnx"));
+
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {3.f, 6.f, 9.f, 12.f});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_length_exceeds_file) {
+    try {
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                 SERIALIZED_ZOO,
+                                 "onnx/external_data/external_data_length_exceeds_file.onnx"));
+        FAIL() << "External data out of the file bounds not detected";
+    } catch (const ngraph_error& error) {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 0, data_length: 32, sha1_digest: 0)"),
+                            error.what());
+    } catch (...) {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
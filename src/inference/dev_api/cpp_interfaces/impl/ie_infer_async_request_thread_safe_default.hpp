@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <exception>
 #include <future>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -273,6 +275,44 @@ public:
         _callback = std::move(callback);
     }
 
+    /**
+     * @brief Sets the request scheduling hints (ov::hint::request_priority and ov::hint::request_deadline),
+     *        the other properties are passed to the synchronous request
+     * @param properties Map of pairs: (property name, property value)
+     */
+    void SetProperties(const ov::AnyMap& properties) override {
+        CheckState();
+        ov::AnyMap syncRequestProperties;
+        for (auto&& property : properties) {
+            if (property.first == ov::hint::request_priority.name()) {
+                _requestPriority = property.second.as<ov::hint::Priority>();
+            } else if (property.first == ov::hint::request_deadline.name()) {
+                // the deadline may come as any integer (e.g. from the bindings), it is read via the string then
+                const auto deadline = property.second.is<uint32_t>() ? int64_t{property.second.as<uint32_t>()}
+                                                                     : std::stoll(property.second.as<std::string>());
+                if (deadline < 0 || deadline > std::numeric_limits<uint32_t>::max()) {
+                    IE_THROW() << "Wrong value " << deadline << " for property key "
+                               << ov::hint::request_deadline.name();
+                }
+                _requestDeadline = std::chrono::milliseconds{deadline};
+            } else {
+                syncRequestProperties.insert(property);
+            }
+        }
+        if (!syncRequestProperties.empty()) {
+            _syncRequest->SetProperties(syncRequestProperties);
+        }
+    }
+
+    ov::Any GetProperty(const std::string& name) const override {
+        if (name == ov::hint::request_priority.name()) {
+            return _requestPriority;
+        } else if (name == ov::hint::request_deadline.name()) {
+            return static_cast<uint32_t>(_requestDeadline.count());
+        }
+        return _syncRequest->GetProperty(name);
+    }
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
         CheckState();
         return _syncRequest->QueryState();
@@ -322,7 +362,11 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _taskPriority._priority = _requestPriority;
+        _taskPriority._deadline = _requestDeadline.count() != 0
+                                      ? std::chrono::steady_clock::now() + _requestDeadline
+                                      : std::chrono::steady_clock::time_point{};
+        RunStage(firstStageExecutor, MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
     }
 
     /**
@@ -381,6 +425,20 @@ protected:
     }
 
 private:
+    /**
+     * @brief Runs a pipeline stage task, the streams executors get the request scheduling hints
+     * @param[in]  executor The stage executor
+     * @param[in]  task The stage task
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor, Task task) {
+        auto streamsExecutor = dynamic_cast<IStreamsExecutor*>(executor.get());
+        if (nullptr != streamsExecutor) {
+            streamsExecutor->RunWithPriority(std::move(task), _taskPriority);
+        } else {
+            executor->run(std::move(task));
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -409,7 +467,8 @@ private:
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                         IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                        RunStage(nextStageExecutor,
+                                 MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
                     }
                 } catch (...) {
                     currentException = std::current_exception();
@@ -456,5 +515,8 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    ov::hint::Priority _requestPriority = ov::hint::Priority::MEDIUM;
+    std::chrono::milliseconds _requestDeadline{0};
+    IStreamsExecutor::TaskPriority _taskPriority;  // the scheduling parameters of the running pipeline
 };
 }  // namespace InferenceEngine
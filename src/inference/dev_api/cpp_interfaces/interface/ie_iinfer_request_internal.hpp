@@ -13,6 +13,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 #include "ie_preprocess_data.hpp"
+#include "openvino/core/any.hpp"
 #include "openvino/core/node_output.hpp"
 #include "so_ptr.hpp"
 
@@ -157,6 +158,19 @@ public:
      */
     virtual std::vector<std::shared_ptr<IVariableStateInternal>> QueryState();
 
+    /**
+     * @brief Sets the request level properties, e.g. the scheduling hints
+     * @param properties Map of pairs: (property name, property value)
+     */
+    virtual void SetProperties(const ov::AnyMap& properties);
+
+    /**
+     * @brief Gets a request level property
+     * @param name A property name
+     * @return A property value
+     */
+    virtual ov::Any GetProperty(const std::string& name) const;
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      * @note The method returns immediately. Inference starts also immediately.
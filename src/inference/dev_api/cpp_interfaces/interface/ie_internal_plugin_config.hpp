@@ -47,8 +47,15 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
 /**
- * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
- * stream
+ * @brief Enables the work stealing task queues of the CPU streams executor (YES/NO, NO by default).
+ * Each stream thread serves its own task queue and steals the tasks of the other threads when it is idle.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
+/**
+ * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type.
+ * The cache is shared between all the streams of a compiled model.
  * @ingroup ie_dev_api_plugin_api
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the input stream over a memory mapped file
+ * @file ie_mmap_stream.hpp
+ */
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+#include "ie_api.h"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Maps the whole file to memory.
+ * @details The mapping is read-only, the pages are shared with the page cache.
+ * @ingroup ie_dev_api_file_utils
+ * @param path A path to the file
+ * @return A buffer which owns the mapping, the file is unmapped when the last reference to it is released.
+ * Empty files are not mapped, `nullptr` is returned for them.
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<ngraph::runtime::AlignedBuffer>) mapFile(const std::string& path);
+
+/**
+ * @brief An input stream reading from a memory region, e.g. a memory mapped cache entry.
+ * @details Plugins can check whether the stream passed to `ImportNetwork` is of this type and refer to the
+ * underlying memory directly (keeping a reference to it) instead of copying large data chunks out of the stream.
+ * The stream positions are offsets from the beginning of the memory region.
+ * @ingroup ie_dev_api_file_utils
+ */
+class INFERENCE_ENGINE_API_CLASS(MappedMemoryStream) : public std::istream {
+public:
+    /**
+     * @brief Constructs the stream over the memory region
+     * @param memory A memory region, must not be `nullptr`
+     */
+    explicit MappedMemoryStream(std::shared_ptr<ngraph::runtime::AlignedBuffer> memory);
+
+    /**
+     * @brief Returns the memory region the stream reads from
+     * @return A shared pointer to the memory region
+     */
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& getMemory() const noexcept;
+
+private:
+    class MemoryBuffer : public std::streambuf {
+    public:
+        MemoryBuffer(char* data, size_t size);
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+    };
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> _memory;
+    MemoryBuffer _buffer;
+};
+
+}  // namespace InferenceEngine
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -44,6 +45,12 @@ public:
 
     void Execute(Task task) override;
 
+    void RunWithPriority(Task task, const TaskPriority& priority) override;
+
+    void ExecuteNested(const std::vector<Task>& tasks, int concurrency) override;
+
+    std::map<ov::hint::Priority, QueueStatistics> GetQueueStatistics() override;
+
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
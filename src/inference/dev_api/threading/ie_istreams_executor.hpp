@@ -9,11 +9,14 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "ie_parameter.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "threading/ie_itask_executor.hpp"
 
 namespace InferenceEngine {
@@ -48,6 +51,25 @@ public:
                       //!< hybrid CPUs)
     };
 
+    /**
+     * @brief Defines the scheduling parameters of a task
+     */
+    struct TaskPriority {
+        ov::hint::Priority _priority = ov::hint::Priority::MEDIUM;  //!< The priority class of the task
+        std::chrono::steady_clock::time_point _deadline = {};        //!< The time the task should be started before.
+                                                                      //!< No deadline by default
+    };
+
+    /**
+     * @brief Defines the queueing statistics of a priority class of tasks
+     */
+    struct QueueStatistics {
+        uint64_t _tasks = 0;                       //!< Number of the started tasks
+        std::chrono::microseconds _totalDelay{0};  //!< Accumulated time the tasks spent in the queue
+        std::chrono::microseconds _maxDelay{0};    //!< Maximal time a task spent in the queue
+        uint64_t _missedDeadlines = 0;             //!< Number of the tasks started after their deadlines
+    };
+
     /**
      * @brief Defines IStreamsExecutor configuration
      */
@@ -103,6 +125,14 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< Each stream thread has its own task queue and the idle stream threads steal
+                                     //!< tasks from the queues of the others, instead of a single shared queue
+        bool _prioritized = false;   //!< The queued tasks are served by the priority and deadline instead of FIFO,
+                                     //!< once the first task with a non default priority or a deadline is queued.
+                                     //!< In the @ref _workStealing mode the tasks queued from then on go to
+                                     //!< the shared priority queue, the stream threads drain their own queues first
+        int _priorityAging = 100;    //!< In the @ref _prioritized mode a queued task is promoted by one priority class
+                                     //!< for each `_priorityAging` milliseconds of waiting
 
         /**
          * @brief      A constructor with arguments
@@ -156,6 +186,29 @@ public:
      * @param task A task to start
      */
     virtual void Execute(Task task) = 0;
+
+    /**
+     * @brief Starts the task asynchronously taking the scheduling parameters into account.
+     * The default implementation ignores the parameters
+     * @param task A task to start
+     * @param priority The task scheduling parameters
+     */
+    virtual void RunWithPriority(Task task, const TaskPriority& priority);
+
+    /**
+     * @brief Executes the tasks concurrently within the current stream, each one in its own nested arena.
+     * The nested arenas inherit the NUMA node, core type and threads pinning of the stream.
+     * Must be called from the stream thread. The default implementation executes the tasks one by one
+     * @param tasks The tasks to execute
+     * @param concurrency Maximal number of threads of each nested arena
+     */
+    virtual void ExecuteNested(const std::vector<Task>& tasks, int concurrency);
+
+    /**
+     * @brief Returns the queueing statistics collected by the executor for each priority class
+     * @return The statistics, empty if the executor does not collect them
+     */
+    virtual std::map<ov::hint::Priority, QueueStatistics> GetQueueStatistics();
 };
 
 }  // namespace InferenceEngine
@@ -40,5 +40,49 @@ namespace CPUConfigParams {
  */
 DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
+/**
+ * @brief The name for defining if independent branches of the model are executed concurrently within one stream
+ *
+ * When enabled, CPU plugin splits the execution graph into waves of mutually independent nodes and runs the nodes
+ * of each wave concurrently on the threads of the stream, dividing the threads of the stream between them.
+ * It is mostly beneficial for multi-branch models inferred with a small number of streams (e.g. latency hint).
+ * The option is ignored for models with dynamic shapes or memory states.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(PARALLEL_BRANCHES);
+
+/**
+ * @brief The name for defining the input shapes a model with dynamic shapes is precompiled for
+ *
+ * The CPU plugin infers the model on each of the given shapes at compile time, so that the shape inference, memory
+ * allocation and primitives creation for these shapes don't happen on the first inference requests.
+ * The value is a list of buckets separated by ';'. Each bucket lists the dims of the dynamic inputs in the form
+ * input_name:d0xd1x...dn separated by ',', e.g. "input_ids:1x32,mask:1x32;input_ids:1x64,mask:1x64".
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), empty by default.
+ */
+DECLARE_CPU_CONFIG_KEY(SHAPE_BUCKETS);
+
+/**
+ * @brief The name for defining how many of the recorded input shapes are replayed when a dynamic model is compiled
+ *
+ * When CACHE_DIR is set, the CPU plugin records the input shapes a dynamic model is inferred with, and infers the
+ * model on the most recent of them at compile time to fill the runtime cache before the first request.
+ * The value is the maximal number of the replayed shapes, "0" disables both the recording and the replay.
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), "16" by default.
+ */
+DECLARE_CPU_CONFIG_KEY(WARMUP_SHAPES_LIMIT);
+
+/**
+ * @brief The name for defining how the memory of the streams is placed on NUMA systems
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * "REPLICATE" (default) - each NUMA node has its own copy of the weights used by the streams of this node,
+ * "LOCAL" - in addition the intermediate memory of each stream is touched by the stream itself at compile time,
+ *           so that the memory pages are placed on the NUMA node of the stream,
+ * "SHARED" - a single copy of the weights is shared by the streams of all NUMA nodes to reduce the memory footprint.
+ */
+DECLARE_CPU_CONFIG_KEY(NUMA_POLICY);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
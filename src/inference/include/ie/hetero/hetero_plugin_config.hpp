@@ -34,5 +34,21 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipelined execution of the subgraphs: each subgraph is loaded to the device with
+ * its own executor (rather than the exclusive one), so the consecutive asynchronous requests are executed by the
+ * subgraphs (stages) concurrently.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
+/**
+ * @brief The key for enabling of the cost-based partitioning of the network: the nodes are assigned to the devices
+ * minimizing the estimated execution time plus the cost of the data transfers between the subgraphs, rather than to
+ * the first device (by priority) supporting them.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_BASED_PARTITIONING);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -229,6 +229,16 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the timeout (in ms) currently used by the auto-batching to collect the inputs.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT, unsigned int);
+
+/**
+ * @brief Metric to get the average fill (from 0 to 1) of the batches collected by the auto-batching.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_FILL, float);
+
 }  // namespace Metrics
 
 /**
@@ -294,6 +304,16 @@ DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
  * @brief Auto-batching configuration: string with timeout (in ms), e.g. "100"
  */
 DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+/**
+ * @brief Auto-batching configuration: string with the latency SLO (in ms), e.g. "50". When set (non-zero), the timeout
+ * is chosen adaptively (within the AUTO_BATCH_TIMEOUT) from the observed requests arrival rate and batch execution time
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_SLO);
+/**
+ * @brief Auto-batching configuration: YES/NO (default) to compile the ladder of the smaller batch sizes (2, 4, ...), so
+ * that the requests collected by the timeout are executed with the smallest batch that fits them (rather than one by one)
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES);
 
 /**
  * @brief Limit `#threads` that are used by Inference Engine for inference on the CPU.
@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -318,6 +319,43 @@ public:
      */
     std::vector<VariableState> query_state();
 
+    /**
+     * @brief Sets properties for the current inference request, for example ov::hint::request_priority.
+     * @note The properties affect the next inference runs of the request.
+     * @param properties Map of pairs: (property name, property value).
+     */
+    void set_property(const AnyMap& properties);
+
+    /**
+     * @brief Sets properties for the current inference request.
+     *
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types.
+     * @param properties Optional pack of pairs: (property name, property value).
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<void, Properties...> set_property(Properties&&... properties) {
+        set_property(AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * @brief Gets a property of the current inference request.
+     * @param name Property key.
+     * @return Property value.
+     */
+    Any get_property(const std::string& name) const;
+
+    /**
+     * @brief Gets a property of the current inference request.
+     *
+     * @tparam T Type of a returned value.
+     * @param property  Property  object.
+     * @return Value of property.
+     */
+    template <typename T, PropertyMutability mutability>
+    T get_property(const ov::Property<T, mutability>& property) const {
+        return get_property(property.name()).template as<T>();
+    }
+
     /**
      * @brief Returns a compiled model that creates this inference request.
      * @return Compiled model object.
@@ -47,5 +47,150 @@ namespace intel_cpu {
  */
 static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATION"};
 
+/**
+ * @brief This property defines whether independent branches of the model are executed concurrently within one stream.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Multi-branch models (Inception-like blocks, multi-head detectors, etc.) inferred with a single stream leave a part
+ * of the stream threads idle on narrow nodes. With this option the CPU plugin executes mutually independent nodes
+ * concurrently, splitting the stream threads between them. The option has no effect on models with dynamic shapes.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::parallel_branches(true)); // enable concurrent execution of independent branches
+ * @endcode
+ */
+static constexpr Property<bool> parallel_branches{"CPU_PARALLEL_BRANCHES"};
+
+/**
+ * @brief This property defines the input shapes a model with dynamic shapes is precompiled for.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Each new input shape of a dynamic model triggers shape inference, memory allocation and primitives creation on the
+ * inference critical path. The shapes listed in this property are processed at compile time instead, which removes
+ * the latency spikes of the first requests with these shapes. Buckets are separated by ';', the inputs of a bucket
+ * are separated by ',' and given in the form input_name:d0xd1x...dn.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::shape_buckets("input_ids:1x128;input_ids:1x256"));
+ * @endcode
+ */
+static constexpr Property<std::string> shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief This property defines how many of the recorded input shapes are replayed when a dynamic model is compiled.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * With ov::cache_dir set, the input shapes a dynamic model is inferred with are recorded in the cache directory,
+ * and the model is inferred on the most recent of them at compile time to fill the runtime cache in advance.
+ * Zero disables both the recording and the replay.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::cache_dir("cache"), ov::intel_cpu::warmup_shapes_limit(4));
+ * @endcode
+ */
+static constexpr Property<uint32_t> warmup_shapes_limit{"CPU_WARMUP_SHAPES_LIMIT"};
+
+/**
+ * @enum NumaPolicy
+ * @brief Defines how the memory of the streams is placed on NUMA systems
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+enum class NumaPolicy {
+    REPLICATE = 0,  //!< Each NUMA node has its own copy of the weights used by the streams of this node
+    LOCAL = 1,      //!< As REPLICATE, plus the intermediate memory of each stream is first touched by the stream itself
+    SHARED = 2,     //!< A single copy of the weights is shared by the streams of all NUMA nodes
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const NumaPolicy& policy) {
+    switch (policy) {
+    case NumaPolicy::REPLICATE:
+        return os << "REPLICATE";
+    case NumaPolicy::LOCAL:
+        return os << "LOCAL";
+    case NumaPolicy::SHARED:
+        return os << "SHARED";
+    default:
+        throw ov::Exception{"Unsupported NUMA policy"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, NumaPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "REPLICATE") {
+        policy = NumaPolicy::REPLICATE;
+    } else if (str == "LOCAL") {
+        policy = NumaPolicy::LOCAL;
+    } else if (str == "SHARED") {
+        policy = NumaPolicy::SHARED;
+    } else {
+        throw ov::Exception{"Unsupported NUMA policy: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief This property defines how the memory of the streams is placed on NUMA systems.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * By default the weights are replicated per NUMA node, so that the streams read the weights from the local memory.
+ * LOCAL policy additionally places the intermediate memory of each stream on the NUMA node of the stream in advance,
+ * while SHARED policy keeps a single copy of the weights for large models that don't fit into memory otherwise.
+ *
+ * @code
+ * core.set_property("CPU", ov::intel_cpu::numa_policy(ov::intel_cpu::NumaPolicy::LOCAL));
+ * @endcode
+ */
+static constexpr Property<NumaPolicy> numa_policy{"CPU_NUMA_POLICY"};
+
+/**
+ * @brief Read-only property of a compiled model with the statistics of the runtime parameters cache.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The runtime cache keeps the primitives and kernels created for particular input shapes of the model, it is shared
+ * between all the streams of the compiled model. The statistics contains the accumulated number of the cache "hits",
+ * "misses" and "evictions".
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::intel_cpu::runtime_cache_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property of a compiled model that reports for each input and output whether the user tensors
+ * are bound to the graph directly, without copying the data.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * A port is reported as zero-copy if a tensor with the port element type and the default (planar) layout is used by
+ * the graph in place of its internal memory. Tensors with an incompatible layout or strides are still copied.
+ * The keys are the port names prefixed with "input:" or "output:", so an input and an output may have the same name.
+ *
+ * @code
+ * auto zeroCopy = compiled_model.get_property(ov::intel_cpu::zero_copy_ports);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, bool>, PropertyMutability::RO> zero_copy_ports{"CPU_ZERO_COPY_PORTS"};
+
+/**
+ * @brief Read-only property of a compiled model with the queueing delay statistics of the inference requests.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The requests are queued to the streams by ov::hint::request_priority and ov::hint::request_deadline. For each
+ * priority class that was served the statistics contains the number of the started requests "<CLASS>:tasks", the
+ * accumulated and the maximal time the requests waited in the queue "<CLASS>:total_delay_us", "<CLASS>:max_delay_us"
+ * and the number of the requests started after their deadlines "<CLASS>:missed_deadlines".
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::intel_cpu::queueing_statistics);
+ * auto highPriorityTasks = stats["HIGH:tasks"];
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> queueing_statistics{
+    "CPU_QUEUEING_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
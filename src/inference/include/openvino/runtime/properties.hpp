@@ -287,6 +287,21 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief High-level OpenVINO inference request priority hint
+ * Defines the order in which the queued inference requests of the same compiled model are served by the device.
+ * A waiting request is gradually promoted, so the low priority requests are not starved.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<Priority> request_priority{"REQUEST_PRIORITY"};
+
+/**
+ * @brief High-level OpenVINO inference request deadline hint, in milliseconds from the request start
+ * The queued requests with deadlines are served in the earliest deadline first order. `0` means no deadline.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t> request_deadline{"REQUEST_DEADLINE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -456,6 +471,41 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property limits the total size (in bytes) of the compiled network blobs in the cache directory
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When a new blob is written and the limit is exceeded, the least recently used blobs are evicted from the cache.
+ * The value 0 (default) means the cache size is not limited. The property is applied to the core only:
+ *
+ * @code
+ * ie.set_property({ov::cache_dir("cache/"), ov::cache_size(1024 * 1024 * 1024)}); // keep up to 1GB of blobs
+ * @endcode
+ */
+static constexpr Property<uint64_t> cache_size{"CACHE_SIZE"};
+
+/**
+ * @brief Read-only property of the compiled model, true if it was imported from the cache or from an exported blob
+ * instead of being compiled
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADED_FROM_CACHE"};
+
+/**
+ * @brief This property defines whether the weights of the models read from files are memory mapped
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The memory mapped weights are loaded on demand and their pages are shared between the processes reading the same
+ * model. The memory mapped constants are read-only. The property is enabled by default and applied to the core only,
+ * it can be disabled e.g. when the constants are modified in place or the model files are located on a network file
+ * system which may change while the model is in use:
+ *
+ * @code
+ * ie.set_property(ov::enable_mmap(false)); // read the weights to memory
+ * @endcode
+ */
+static constexpr Property<bool> enable_mmap{"ENABLE_MMAP"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
@@ -495,6 +545,35 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the latency SLO (in ms) for the auto-batching. When set (non-zero), the timeout to
+ * collect the inputs is chosen adaptively (not exceeding the auto_batch_timeout) from the observed requests arrival
+ * rate and the batch execution time, to fill the batch as much as the SLO allows
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
+/**
+ * @brief Read-write property to enable (false by default) the ladder of the smaller batch sizes for the auto-batching.
+ * The requests collected by the timeout are then executed with the smallest batch that fits them, at the cost of
+ * compiling (and keeping in memory) the additional networks
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
+/**
+ * @brief Read-only property to get the timeout (in ms) currently used by the auto-batching to collect the inputs
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RO> auto_batch_effective_timeout{
+    "AUTO_BATCH_EFFECTIVE_TIMEOUT"};
+
+/**
+ * @brief Read-only property to get the average fill (from 0 to 1) of the batches collected by the auto-batching
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<float, PropertyMutability::RO> auto_batch_fill{"AUTO_BATCH_FILL"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -12,10 +12,18 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_mmap_stream.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
 #include "openvino/pass/manager.hpp"
@@ -69,14 +77,15 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
 
     IE_ASSERT(network.getFunction());
 
-    uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function, the full 128-bit digest is kept in the result
+    std::array<uint64_t, 2> modelHash = {};
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(modelHash);
     m.run_passes(net.getFunction());
 
+    uint64_t seed = 0;
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
@@ -121,7 +130,10 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         seed = hash_combine(seed, as_int32_t(info->getLayout()));
     }
 
-    return std::to_string(seed);
+    std::ostringstream hash;
+    hash << std::hex << std::setfill('0') << std::setw(16) << modelHash[0] << std::setw(16) << modelHash[1] << '_'
+         << std::setw(16) << seed;
+    return hash.str();
 }
 
 std::string NetworkCompilationContext::computeHash(const std::string& modelName,
@@ -142,11 +154,110 @@ std::string NetworkCompilationContext::computeHash(const std::string& modelName,
 
 //////////////////////////////////////////////////
 
+namespace {
+
+constexpr uint64_t checksumMul1 = 0x87c37b91114253d5ULL;
+constexpr uint64_t checksumMul2 = 0x4cf5ad432745937fULL;
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t mixWord(uint64_t hash, uint64_t word) {
+    return rotl64(hash ^ (rotl64(word * checksumMul1, 31) * checksumMul2), 27) * 5 + 0x52dce729;
+}
+
+// the stream is read by chunks of this size
+constexpr size_t checksumChunkSize = 1 << 20;
+
+}  // namespace
+
+void BlobChecksum::update(const char* data, size_t size) {
+    constexpr size_t wordSize = sizeof(uint64_t);
+    size_t tailSize = m_size % wordSize;
+    m_size += size;
+    if (tailSize) {
+        const auto n = std::min(size, wordSize - tailSize);
+        std::memcpy(m_tail + tailSize, data, n);
+        data += n;
+        size -= n;
+        tailSize += n;
+        if (tailSize < wordSize) {
+            return;
+        }
+        uint64_t word;
+        std::memcpy(&word, m_tail, wordSize);
+        m_hash = mixWord(m_hash, word);
+    }
+    for (; size >= wordSize; data += wordSize, size -= wordSize) {
+        uint64_t word;
+        std::memcpy(&word, data, wordSize);
+        m_hash = mixWord(m_hash, word);
+    }
+    std::memcpy(m_tail, data, size);
+}
+
+uint64_t BlobChecksum::get() const {
+    uint64_t word = 0;
+    std::memcpy(&word, m_tail, m_size % sizeof(uint64_t));
+    uint64_t hash = mixWord(m_hash, word) ^ m_size;
+    // final avalanche from MurmurHash3
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash ? hash : 1;
+}
+
+uint64_t BlobChecksum::calculate(const char* data, size_t size) {
+    BlobChecksum checksum;
+    const auto blobSize = static_cast<uint64_t>(size);
+    checksum.update(reinterpret_cast<const char*>(&blobSize), sizeof(blobSize));
+    checksum.update(data, size);
+    return checksum.get();
+}
+
+uint64_t BlobChecksum::calculate(std::istream& stream) {
+    const auto pos = stream.tellg();
+    if (auto mappedStream = dynamic_cast<MappedMemoryStream*>(&stream)) {
+        const auto& memory = mappedStream->getMemory();
+        const auto offset = static_cast<size_t>(pos);
+        return calculate(memory->get_ptr<char>() + offset, memory->size() - offset);
+    }
+    stream.seekg(0, std::ios_base::end);
+    const auto end = stream.tellg();
+    if (pos == std::streampos(-1) || end == std::streampos(-1)) {
+        stream.clear();
+        stream.seekg(pos);
+        // the digest of the stream can't be calculated, it never matches a stored one
+        return 0;
+    }
+    const auto size = static_cast<size_t>(end - pos);
+    BlobChecksum checksum;
+    const auto blobSize = static_cast<uint64_t>(size);
+    checksum.update(reinterpret_cast<const char*>(&blobSize), sizeof(blobSize));
+    stream.seekg(pos);
+    std::vector<char> buffer(std::min(size, checksumChunkSize));
+    for (size_t offset = 0; offset < size && stream.good();) {
+        stream.read(buffer.data(), std::min(size - offset, buffer.size()));
+        const auto count = static_cast<size_t>(stream.gcount());
+        checksum.update(buffer.data(), count);
+        offset += count;
+    }
+    stream.clear();
+    stream.seekg(pos);
+    return checksum.get();
+}
+
+//////////////////////////////////////////////////
+
 CompiledBlobHeader::CompiledBlobHeader() {}
 
-CompiledBlobHeader::CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo)
+CompiledBlobHeader::CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo, uint64_t checksum)
     : m_ieVersion(ieVersion),
-      m_fileInfo(fileInfo) {}
+      m_fileInfo(fileInfo),
+      m_checksum(checksum) {}
 
 std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header) {
     std::string xmlStr;
@@ -162,6 +273,7 @@ std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header) {
     pugi::xml_node compiledBlobNode = document.document_element();
     header.m_ieVersion = XMLParseUtils::GetStrAttr(compiledBlobNode, "ie_version");
     header.m_fileInfo = XMLParseUtils::GetStrAttr(compiledBlobNode, "file_info");
+    header.m_checksum = std::stoull(XMLParseUtils::GetStrAttr(compiledBlobNode, "checksum", "0"), nullptr, 16);
 
     return stream;
 }
@@ -171,6 +283,10 @@ std::ostream& operator<<(std::ostream& stream, const CompiledBlobHeader& header)
     auto compiledBlobNode = document.append_child("compiled_blob");
     compiledBlobNode.append_attribute("ie_version").set_value(header.m_ieVersion.c_str());
     compiledBlobNode.append_attribute("file_info").set_value(header.m_fileInfo.c_str());
+    // the fixed width keeps the header size, so the checksum can be patched once the blob is written
+    std::ostringstream checksum;
+    checksum << std::hex << std::setw(16) << std::setfill('0') << header.m_checksum;
+    compiledBlobNode.append_attribute("checksum").set_value(checksum.str().c_str());
 
     document.save(stream, nullptr, pugi::format_raw);
     document.reset();
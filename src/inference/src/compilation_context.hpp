@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <istream>
 #include <map>
 #include <ostream>
@@ -22,13 +23,40 @@ struct NetworkCompilationContext final {
                                    const std::map<std::string, std::string>& compileOptions);
 };
 
+/**
+ * @brief Digest of the compiled blob: its size and all of its data.
+ * It detects the truncated and the corrupted cache entries, it is not a cryptographic hash.
+ */
+class BlobChecksum final {
+    uint64_t m_hash = 0x9ae16a3b2f90404fULL;
+    uint64_t m_size = 0;
+    char m_tail[sizeof(uint64_t)] = {};
+
+    void update(const char* data, size_t size);
+    uint64_t get() const;
+
+public:
+    /**
+     * @brief Calculates the digest of the blob in memory, never returns 0
+     */
+    static uint64_t calculate(const char* data, size_t size);
+
+    /**
+     * @brief Calculates the digest of the data from the current stream position to the end of the stream
+     * The stream position is restored
+     */
+    static uint64_t calculate(std::istream& stream);
+};
+
 class CompiledBlobHeader final {
     std::string m_ieVersion;
     std::string m_fileInfo;
+    // checksum of the blob following the header, 0 if it is not known
+    uint64_t m_checksum = 0;
 
 public:
     CompiledBlobHeader();
-    CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo);
+    CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo, uint64_t checksum = 0);
 
     const std::string& getIeVersion() const {
         return m_ieVersion;
@@ -38,6 +66,14 @@ public:
         return m_fileInfo;
     }
 
+    uint64_t getChecksum() const {
+        return m_checksum;
+    }
+
+    void setChecksum(uint64_t checksum) {
+        m_checksum = checksum;
+    }
+
     friend std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header);
 
     friend std::ostream& operator<<(std::ostream& stream, const CompiledBlobHeader& header);
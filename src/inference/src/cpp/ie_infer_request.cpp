@@ -505,6 +505,14 @@ std::vector<VariableState> InferRequest::query_state() {
     return variable_states;
 }
 
+void InferRequest::set_property(const AnyMap& properties) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetProperties(properties);)
+}
+
+Any InferRequest::get_property(const std::string& name) const {
+    OV_INFER_REQ_CALL_STATEMENT(return _impl->GetProperty(name);)
+}
+
 CompiledModel InferRequest::get_compiled_model() {
     OV_INFER_REQ_CALL_STATEMENT(return {_impl->getPointerToExecutableNetworkInternal(), _so});
 }
@@ -436,6 +436,14 @@ std::vector<std::shared_ptr<IVariableStateInternal>> IInferRequestInternal::Quer
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetProperties(const ov::AnyMap&) {
+    IE_THROW(NotImplemented);
+}
+
+ov::Any IInferRequestInternal::GetProperty(const std::string&) const {
+    IE_THROW(NotImplemented);
+}
+
 void IInferRequestInternal::StartAsync() {
     checkBlobs();
     StartAsyncImpl();
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <vector>
+
+#include "ie_mmap_stream.hpp"
+#include "openvino/util/file_util.hpp"
+
+#ifndef _WIN32
+#    include <unistd.h>
+#    include <utime.h>
+#else
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <Windows.h>
+#    include <process.h>
+#    include <sys/utime.h>
+#    define stat   _stat
+#    define utime  _utime
+#    define getpid _getpid
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+const std::string blobExt = ".blob";
+const std::string tmpExt = ".tmp";
+// temporary files left by crashed writers are removed after this period
+constexpr std::time_t staleTmpFileAge = 60 * 60;
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// The name is unique across the threads and the processes sharing the cache directory
+std::string getTmpFile(const std::string& blobFile) {
+    static std::atomic<uint64_t> counter{0};
+    return blobFile + "." + std::to_string(getpid()) + "_" + std::to_string(counter++) + tmpExt;
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+#ifndef _WIN32
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#else
+    return ::MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#endif
+}
+
+}  // namespace
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tmpFileName = getTmpFile(blobFileName);
+    bool completed = false;
+    try {
+        // the stream is readable, so the writer can calculate the digest of the written data
+        std::fstream stream(tmpFileName, std::ios_base::binary | std::ios_base::in | std::ios_base::out |
+                                             std::ios_base::trunc);
+        writer(stream);
+        stream.close();
+        completed = !stream.fail();
+    } catch (...) {
+        std::remove(tmpFileName.c_str());
+        throw;
+    }
+    // the entry file is replaced as a whole: the readers (and the networks imported from it) either see the old
+    // file or the new complete one
+    if (!completed || !replaceFile(tmpFileName, blobFileName)) {
+        std::remove(tmpFileName.c_str());
+        return;
+    }
+    if (m_maxSize > 0) {
+        evictEntries(blobFileName);
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName)) {
+        // the modification time is used as the last access time by the eviction
+        // (access time is not reliable, it is often disabled or relaxed on Linux)
+        utime(blobFileName.c_str(), nullptr);
+        std::shared_ptr<ngraph::runtime::AlignedBuffer> memory;
+        try {
+            memory = mapFile(blobFileName);
+        } catch (...) {
+            // fallback to the regular file stream
+        }
+        if (memory) {
+            MappedMemoryStream stream(memory);
+            reader(stream);
+        } else {
+            std::ifstream stream(blobFileName, std::ios_base::binary);
+            reader(stream);
+        }
+    }
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+void FileStorageCacheManager::evictEntries(const std::string& keepFile) {
+    struct Entry {
+        std::string path;
+        uint64_t size;
+        std::time_t lastAccess;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    const auto now = std::time(nullptr);
+    const auto keepName = ov::util::get_file_name(keepFile);
+
+    ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool isDir) {
+        struct stat fileStat;
+        if (isDir || stat(file.c_str(), &fileStat) != 0) {
+            return;
+        }
+        if (endsWith(file, tmpExt)) {
+            // the entry being written by another thread or process is skipped unless its writer is gone
+            if (now - fileStat.st_mtime > staleTmpFileAge) {
+                std::remove(file.c_str());
+            }
+            return;
+        }
+        if (!endsWith(file, blobExt)) {
+            return;
+        }
+        const auto size = static_cast<uint64_t>(fileStat.st_size);
+        totalSize += size;
+        if (ov::util::get_file_name(file) != keepName) {
+            entries.push_back({file, size, fileStat.st_mtime});
+        }
+    });
+    if (totalSize <= m_maxSize) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.lastAccess != b.lastAccess ? a.lastAccess < b.lastAccess : a.path < b.path;
+    });
+    for (const auto& entry : entries) {
+        // another process may have evicted the entry already, or it can't be removed while it is mapped (Windows)
+        if (std::remove(entry.path.c_str()) == 0) {
+            totalSize -= entry.size;
+        }
+        if (totalSize <= m_maxSize) {
+            break;
+        }
+    }
+}
+
+}  // namespace InferenceEngine
@@ -9,7 +9,7 @@
  */
 #pragma once
 
-#include <fstream>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -76,21 +76,32 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * Cache entries are read through a memory mapping, so plugins can refer to the mapped data instead of copying it.
+ * Entries are written to a temporary file which is renamed to the entry name once it is complete, so neither other
+ * threads nor other processes sharing the cache directory can observe a partially written entry, and the file
+ * of an entry which is still mapped by an imported network is never modified.
+ * If the cache size is limited, the least recently used entries are evicted after each write.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_maxSize;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    void evictEntries(const std::string& keepFile);
+
 public:
     /**
      * @brief Constructor
-     *
+     * @param cachePath The cache directory
+     * @param maxSize The maximum total size of the entries in bytes, 0 means unlimited
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t maxSize = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_maxSize(maxSize) {}
 
     /**
      * @brief Destructor
@@ -99,24 +110,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
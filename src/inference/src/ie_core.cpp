@@ -6,9 +6,11 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <threading/ie_executor_manager.hpp>
 #include <vector>
@@ -244,12 +246,37 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            auto it = config.find(ov::cache_size.name());
             if (it != config.end()) {
+                uint64_t cacheSize = 0;
+                try {
+                    size_t parsed = 0;
+                    // std::stoull accepts the negative values wrapping them around
+                    if (it->second.find('-') != std::string::npos)
+                        throw std::invalid_argument(it->second);
+                    cacheSize = std::stoull(it->second, &parsed);
+                    if (parsed != it->second.size())
+                        throw std::invalid_argument(it->second);
+                } catch (...) {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << ov::cache_size.name()
+                               << ". Expected non-negative integer value";
+                }
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-                fillConfig(_cacheConfig, it->second);
+                _cacheSize = cacheSize;
+                // re-create the cache managers for the new limit
+                fillConfig(_cacheConfig, _cacheConfig._cacheDir, _cacheSize);
                 for (auto& deviceCfg : _cacheConfigPerDevice) {
-                    fillConfig(deviceCfg.second, it->second);
+                    fillConfig(deviceCfg.second, deviceCfg.second._cacheDir, _cacheSize);
+                }
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
+            if (it != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                fillConfig(_cacheConfig, it->second, _cacheSize);
+                for (auto& deviceCfg : _cacheConfigPerDevice) {
+                    fillConfig(deviceCfg.second, it->second, _cacheSize);
                 }
                 config.erase(it);
             }
@@ -260,11 +287,18 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 executorManager()->setTbbFlag(flag);
                 config.erase(it);
             }
+
+            it = config.find(ov::enable_mmap.name());
+            if (it != config.end()) {
+                auto flag = it->second == CONFIG_VALUE(YES) ? true : false;
+                _enableMmap = flag;
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
             std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-            fillConfig(_cacheConfigPerDevice[name], dir);
+            fillConfig(_cacheConfigPerDevice[name], dir, _cacheSize);
         }
 
         std::string get_cache_dir() const {
@@ -272,6 +306,15 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig._cacheDir;
         }
 
+        uint64_t get_cache_size() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _cacheSize;
+        }
+
+        bool get_enable_mmap() const {
+            return _enableMmap;
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig getCacheConfigForDevice(const std::string& device_name,
@@ -279,7 +322,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                             std::map<std::string, std::string>& parsedConfig) const {
             if (parsedConfig.count(CONFIG_KEY(CACHE_DIR))) {
                 CoreConfig::CacheConfig tempConfig;
-                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)));
+                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)), get_cache_size());
                 if (!deviceSupportsCacheDir) {
                     parsedConfig.erase(CONFIG_KEY(CACHE_DIR));
                 }
@@ -304,11 +347,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         }
 
     private:
-        static void fillConfig(CacheConfig& config, const std::string& dir) {
+        static void fillConfig(CacheConfig& config, const std::string& dir, uint64_t cacheSize) {
             config._cacheDir = dir;
             if (!dir.empty()) {
                 FileUtils::createDirectoryRecursive(dir);
-                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir);
+                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir, cacheSize);
             } else {
                 config._cacheManager = nullptr;
             }
@@ -318,6 +361,8 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+        uint64_t _cacheSize = 0;
+        std::atomic<bool> _enableMmap{true};
     };
 
     struct CacheContent {
@@ -414,10 +459,25 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
                 cacheContent.cacheManager->writeCacheEntry(cacheContent.blobId, [&](std::ostream& networkStream) {
-                    networkStream << ie::CompiledBlobHeader(
+                    ie::CompiledBlobHeader header(
                         ie::GetInferenceEngineVersion()->buildNumber,
                         ie::NetworkCompilationContext::calculateFileInfo(cacheContent.modelPath));
+                    const auto headerPos = networkStream.tellp();
+                    networkStream << header;
+                    // The plugins refer to the stream positions in the exported data and may seek back to rewrite it,
+                    // so the blob is exported right after the header and the digest of its final content is patched
+                    // into the header. It stays unknown (0) if the cache manager's stream can't be read back
+                    auto stream = dynamic_cast<std::iostream*>(&networkStream);
+                    const auto blobPos = networkStream.tellp();
                     execNetwork->Export(networkStream);
+                    if (stream && headerPos != std::streampos(-1) && blobPos != std::streampos(-1)) {
+                        stream->flush();
+                        stream->seekg(blobPos);
+                        header.setChecksum(ie::BlobChecksum::calculate(*stream));
+                        stream->seekp(headerPos);
+                        *stream << header;
+                        stream->seekp(0, std::ios_base::end);
+                    }
                 });
             } catch (...) {
                 cacheContent.cacheManager->removeCacheEntry(cacheContent.blobId);
@@ -454,6 +514,10 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                         // Original file is changed, don't use cache
                         throw ie::NetworkNotRead("Original model file is changed");
                     }
+                    if (header.getChecksum() != 0 && header.getChecksum() != ie::BlobChecksum::calculate(networkStream)) {
+                        // Truncated or corrupted blob, don't use cache
+                        throw ie::NetworkNotRead("Compiled blob checksum does not match");
+                    }
                 } catch (...) {
                     throw HeaderException();
                 }
@@ -631,7 +695,12 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        return InferenceEngine::details::ReadNetwork(modelPath,
+                                                     binPath,
+                                                     extensions,
+                                                     ov_extensions,
+                                                     newAPI,
+                                                     coreConfig.get_enable_mmap());
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model,
@@ -786,6 +855,8 @@ public:
                 if (deviceName.find("AUTO") == std::string::npos && deviceName.find("MULTI") == std::string::npos)
                     config.erase(batch_timeout_mode);
             }
+            config.erase(ov::auto_batch_latency_slo.name());
+            config.erase(ov::auto_batch_partial_batches.name());
         }
     }
 
@@ -986,6 +1057,10 @@ public:
             return decltype(ov::force_tbb_terminate)::value_type(flag);
         } else if (name == ov::cache_dir.name()) {
             return ov::Any(coreConfig.get_cache_dir());
+        } else if (name == ov::cache_size.name()) {
+            return decltype(ov::cache_size)::value_type(coreConfig.get_cache_size());
+        } else if (name == ov::enable_mmap.name()) {
+            return decltype(ov::enable_mmap)::value_type(coreConfig.get_enable_mmap());
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
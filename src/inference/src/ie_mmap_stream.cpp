@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mmap_stream.hpp"
+
+#include <stdexcept>
+
+#include "ie_common.h"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> mapFile(const std::string& path) {
+    std::shared_ptr<ov::util::MappedMemory> mapping;
+    try {
+        mapping = ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error& error) {
+        IE_THROW() << error.what();
+    }
+    if (mapping->size() == 0) {
+        return nullptr;
+    }
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(mapping->data(),
+                                                                                                    mapping->size(),
+                                                                                                    mapping);
+}
+
+MappedMemoryStream::MemoryBuffer::MemoryBuffer(char* data, size_t size) {
+    setg(data, data, data + size);
+}
+
+MappedMemoryStream::MemoryBuffer::pos_type MappedMemoryStream::MemoryBuffer::seekoff(off_type off,
+                                                                                     std::ios_base::seekdir dir,
+                                                                                     std::ios_base::openmode which) {
+    if (!(which & std::ios_base::in)) {
+        return pos_type(off_type(-1));
+    }
+    off_type pos = 0;
+    switch (dir) {
+    case std::ios_base::beg:
+        pos = off;
+        break;
+    case std::ios_base::cur:
+        pos = (gptr() - eback()) + off;
+        break;
+    case std::ios_base::end:
+        pos = (egptr() - eback()) + off;
+        break;
+    default:
+        return pos_type(off_type(-1));
+    }
+    if (pos < 0 || pos > egptr() - eback()) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), eback() + pos, egptr());
+    return pos_type(pos);
+}
+
+MappedMemoryStream::MemoryBuffer::pos_type MappedMemoryStream::MemoryBuffer::seekpos(pos_type pos,
+                                                                                     std::ios_base::openmode which) {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+MappedMemoryStream::MappedMemoryStream(std::shared_ptr<ngraph::runtime::AlignedBuffer> memory)
+    : std::istream(nullptr),
+      _memory(std::move(memory)),
+      _buffer(_memory->get_ptr<char>(), _memory->size()) {
+    rdbuf(&_buffer);
+}
+
+const std::shared_ptr<ngraph::runtime::AlignedBuffer>& MappedMemoryStream::getMemory() const noexcept {
+    return _memory;
+}
+
+}  // namespace InferenceEngine
@@ -416,7 +416,8 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
-                                bool newAPI) {
+                                bool newAPI,
+                                bool enableMmap) {
 #ifdef ENABLE_IR_V7_READER
     // IR v7 obsolete code
     {
@@ -461,6 +462,10 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
         FE->add_extension(ov_exts);
         if (!exts.empty())
             FE->add_extension(wrap_old_extensions(exts));
+        // the flag is passed only to the frontends which understand it, the others reject unknown parameters
+        if (FE->get_name() == "ir" || FE->get_name() == "onnx") {
+            params.emplace_back(enableMmap);
+        }
         inputModel = FE->load(params);
     }
 
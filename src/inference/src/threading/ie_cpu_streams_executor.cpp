@@ -4,10 +4,14 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -18,6 +22,9 @@
 #include <vector>
 
 #include "ie_parallel_custom_arena.hpp"
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#    include <tbb/task_group.h>
+#endif
 #include "ie_system_conf.h"
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_thread_affinity.hpp"
@@ -34,25 +41,44 @@ struct CPUStreamsExecutor::Impl {
             int _ncpus = 0;
             int _threadBindingStep = 0;
             int _offset = 0;
+            bool _nested = false;
             Observer(custom::task_arena& arena,
                      CpuSet mask,
                      int ncpus,
-                     const int streamId,
-                     const int threadsPerStream,
+                     const int firstThread,
                      const int threadBindingStep,
-                     const int threadBindingOffset)
+                     const int threadBindingOffset,
+                     const bool nested)
                 : custom::task_scheduler_observer(arena),
                   _mask{std::move(mask)},
                   _ncpus(ncpus),
                   _threadBindingStep(threadBindingStep),
-                  _offset{streamId * threadsPerStream + threadBindingOffset} {}
+                  _offset{firstThread + threadBindingOffset},
+                  _nested{nested} {}
+            // the masks the threads had before they joined the nested arenas, the innermost one last
+            static std::vector<std::tuple<CpuSet, int>>& SavedMasks() {
+                thread_local std::vector<std::tuple<CpuSet, int>> masks;
+                return masks;
+            }
             void on_scheduler_entry(bool) override {
+                if (_nested) {
+                    SavedMasks().emplace_back(GetCurrentThreadMask());
+                }
                 PinThreadToVacantCore(_offset + tbb::this_task_arena::current_thread_index(),
                                       _threadBindingStep,
                                       _ncpus,
                                       _mask);
             }
             void on_scheduler_exit(bool) override {
+                // the stream threads leaving the nested arena get back their own cores
+                if (_nested && !SavedMasks().empty()) {
+                    auto saved = std::move(SavedMasks().back());
+                    SavedMasks().pop_back();
+                    if (nullptr != std::get<0>(saved)) {
+                        PinCurrentThreadByMask(std::get<1>(saved), std::get<0>(saved));
+                        return;
+                    }
+                }
                 PinCurrentThreadByMask(_ncpus, _mask);
             }
             ~Observer() override = default;
@@ -78,16 +104,10 @@ struct CPUStreamsExecutor::Impl {
                                                                              : _impl->_config._threadsPerStream;
             if (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) {
                 if (Config::PreferredCoreType::ROUND_ROBIN != _impl->_config._threadPreferredCoreType) {
-                    if (Config::PreferredCoreType::ANY == _impl->_config._threadPreferredCoreType) {
-                        _taskArena.reset(new custom::task_arena{concurrency});
-                    } else {
-                        const auto selected_core_type =
-                            Config::PreferredCoreType::BIG == _impl->_config._threadPreferredCoreType
-                                ? custom::info::core_types().back()    // running on Big cores only
-                                : custom::info::core_types().front();  // running on Little cores only
-                        _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
-                                                                    .set_core_type(selected_core_type)
-                                                                    .set_max_concurrency(concurrency)});
+                    if (Config::PreferredCoreType::ANY != _impl->_config._threadPreferredCoreType) {
+                        _coreType = Config::PreferredCoreType::BIG == _impl->_config._threadPreferredCoreType
+                                        ? custom::info::core_types().back()    // running on Big cores only
+                                        : custom::info::core_types().front();  // running on Little cores only
                     }
                 } else {
                     // assigning the stream to the core type in the round-robin fashion
@@ -95,7 +115,7 @@ struct CPUStreamsExecutor::Impl {
                     // together)
                     const auto total_streams = _impl->total_streams_on_core_types.back().second;
                     const auto streamId_wrapped = _streamId % total_streams;
-                    const auto& selected_core_type =
+                    _coreType =
                         std::find_if(
                             _impl->total_streams_on_core_types.cbegin(),
                             _impl->total_streams_on_core_types.cend(),
@@ -103,31 +123,15 @@ struct CPUStreamsExecutor::Impl {
                                 return p.second > streamId_wrapped;
                             })
                             ->first;
-                    _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
-                                                                .set_core_type(selected_core_type)
-                                                                .set_max_concurrency(concurrency)});
-                }
-            } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
-                _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{_numaNodeId, concurrency}});
-            } else if ((0 != _impl->_config._threadsPerStream) ||
-                       (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
-                _taskArena.reset(new custom::task_arena{concurrency});
-                if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
-                    CpuSet processMask;
-                    int ncpus = 0;
-                    std::tie(processMask, ncpus) = GetProcessMask();
-                    if (nullptr != processMask) {
-                        _observer.reset(new Observer{*_taskArena,
-                                                     std::move(processMask),
-                                                     ncpus,
-                                                     _streamId,
-                                                     _impl->_config._threadsPerStream,
-                                                     _impl->_config._threadBindingStep,
-                                                     _impl->_config._threadBindingOffset});
-                        _observer->observe(true);
-                    }
                 }
             }
+            if ((ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) ||
+                (ThreadBindingType::NUMA == _impl->_config._threadBindingType) ||
+                (0 != _impl->_config._threadsPerStream) ||
+                (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
+                _taskArena = CreateArena(concurrency);
+                _observer = CreateObserver(*_taskArena, _streamId * _impl->_config._threadsPerStream, false);
+            }
 #elif IE_THREAD == IE_THREAD_OMP
             omp_set_num_threads(_impl->_config._threadsPerStream);
             if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
@@ -167,9 +171,77 @@ struct CPUStreamsExecutor::Impl {
             if (nullptr != _observer) {
                 _observer->observe(false);
             }
+            for (auto& arenas : _nestedArenas) {
+                for (auto& nested : arenas.second) {
+                    if (nullptr != nested._observer) {
+                        nested._observer->observe(false);
+                    }
+                }
+            }
 #endif
         }
 
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        // The arenas of the stream and its nested ones are bound to the same NUMA node or core type
+        std::unique_ptr<custom::task_arena> CreateArena(int concurrency) const {
+            if (custom::task_arena::automatic != _coreType) {
+                return std::unique_ptr<custom::task_arena>{
+                    new custom::task_arena{custom::task_arena::constraints{}
+                                               .set_core_type(_coreType)
+                                               .set_max_concurrency(concurrency)}};
+            }
+            if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+                return std::unique_ptr<custom::task_arena>{
+                    new custom::task_arena{custom::task_arena::constraints{_numaNodeId, concurrency}}};
+            }
+            return std::unique_ptr<custom::task_arena>{new custom::task_arena{concurrency}};
+        }
+
+        // In the cores binding mode the threads of the arena are pinned to the cores starting from the given one.
+        // The threads leaving a nested arena get back the binding they had before, e.g. the stream thread its core
+        std::unique_ptr<Observer> CreateObserver(custom::task_arena& arena, int firstThread, bool nested) const {
+            if (ThreadBindingType::CORES != _impl->_config._threadBindingType) {
+                return nullptr;
+            }
+            CpuSet processMask;
+            int ncpus = 0;
+            std::tie(processMask, ncpus) = GetProcessMask();
+            if (nullptr == processMask) {
+                return nullptr;
+            }
+            std::unique_ptr<Observer> observer{new Observer{arena,
+                                                            std::move(processMask),
+                                                            ncpus,
+                                                            firstThread,
+                                                            _impl->_config._threadBindingStep,
+                                                            _impl->_config._threadBindingOffset,
+                                                            nested}};
+            observer->observe(true);
+            return observer;
+        }
+
+        // The nested arenas split the stream threads, so the i-th one takes the cores that follow the ones of the
+        // previous arenas
+        std::vector<custom::task_arena*> GetNestedArenas(size_t count, int concurrency) {
+            auto& arenas = _nestedArenas[concurrency];
+            while (arenas.size() < count) {
+                NestedArena nested;
+                nested._arena = CreateArena(concurrency);
+                nested._observer =
+                    CreateObserver(*nested._arena,
+                                   _streamId * _impl->_config._threadsPerStream +
+                                       static_cast<int>(arenas.size()) * concurrency,
+                                   true);
+                arenas.emplace_back(std::move(nested));
+            }
+            std::vector<custom::task_arena*> result;
+            for (size_t i = 0; i < count; i++) {
+                result.push_back(arenas[i]._arena.get());
+            }
+            return result;
+        }
+#endif
+
         Impl* _impl = nullptr;
         int _streamId = 0;
         int _numaNodeId = 0;
@@ -178,6 +250,13 @@ struct CPUStreamsExecutor::Impl {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<custom::task_arena> _taskArena;
         std::unique_ptr<Observer> _observer;
+        custom::core_type_id _coreType = custom::task_arena::automatic;
+        struct NestedArena {
+            std::unique_ptr<custom::task_arena> _arena;
+            std::unique_ptr<Observer> _observer;
+        };
+        // by the concurrency of the nested arenas
+        std::map<int, std::vector<NestedArena>> _nestedArenas;
 #endif
     };
 
@@ -217,7 +296,19 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._workStealing) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _localQueues.emplace_back(new LocalQueue);
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            if (_config._workStealing) {
+                _threads.emplace_back([this, streamId] {
+                    openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                    WorkStealingLoop(streamId);
+                });
+                continue;
+            }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
@@ -225,11 +316,10 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return HasQueuedTasks() || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        if (HasQueuedTasks()) {
+                            task = PopQueuedTask();
                         }
                     }
                     if (task) {
@@ -240,14 +330,146 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, const TaskPriority& priority = {}) {
+        // the priority queue is only used once some task gets the scheduling hints, so the executors without
+        // them don't pay for the timestamps and the heap
+        const bool prioritized = _config._prioritized && (_usePriorityQueue || !IsDefault(priority));
+        if (_config._workStealing && !prioritized) {
+            EnqueueLocal(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _usePriorityQueue = _usePriorityQueue || prioritized;
+            if (_usePriorityQueue) {
+                PushPrioritized(std::move(task), priority);
+            } else {
+                _taskQueue.emplace(std::move(task));
+            }
+            if (_config._workStealing) {
+                // the sleeping stream threads wait for the pending tasks under the shared mutex
+                _pendingTasks++;
+            }
         }
         _queueCondVar.notify_one();
     }
 
+    // The prioritized tasks are served in the order of the effective deadlines, the earliest first. The effective
+    // deadline of a task is its enqueue time shifted by `_priorityAging` for each priority class below HIGH, so a
+    // waiting task catches up with the newer tasks of the higher classes and is never starved. An explicit deadline
+    // makes the effective one only earlier.
+    void PushPrioritized(Task task, const TaskPriority& priority) {
+        const auto now = std::chrono::steady_clock::now();
+        const auto classRank = static_cast<int>(ov::hint::Priority::HIGH) - static_cast<int>(priority._priority);
+        auto key = now + classRank * std::chrono::milliseconds{_config._priorityAging};
+        const bool hasDeadline = priority._deadline != std::chrono::steady_clock::time_point{};
+        if (hasDeadline) {
+            key = std::min(key, priority._deadline);
+        }
+        _prioritizedTasks.push_back({std::move(task), key, _prioritizedSeq++, now, priority, hasDeadline});
+        std::push_heap(_prioritizedTasks.begin(), _prioritizedTasks.end());
+    }
+
+    static bool IsDefault(const TaskPriority& priority) {
+        return priority._priority == TaskPriority{}._priority &&
+               priority._deadline == std::chrono::steady_clock::time_point{};
+    }
+
+    bool HasQueuedTasks() const {
+        return !_taskQueue.empty() || !_prioritizedTasks.empty();
+    }
+
+    Task PopQueuedTask() {
+        // the tasks queued before the priority queue was turned on are the oldest ones
+        if (!_taskQueue.empty()) {
+            auto task = std::move(_taskQueue.front());
+            _taskQueue.pop();
+            return task;
+        }
+        std::pop_heap(_prioritizedTasks.begin(), _prioritizedTasks.end());
+        auto prioritized = std::move(_prioritizedTasks.back());
+        _prioritizedTasks.pop_back();
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto delay =
+            std::chrono::duration_cast<std::chrono::microseconds>(now - prioritized._enqueueTime);
+        auto& statistics = _queueStatistics[prioritized._priority._priority];
+        statistics._tasks++;
+        statistics._totalDelay += delay;
+        statistics._maxDelay = std::max(statistics._maxDelay, delay);
+        if (prioritized._hasDeadline && now > prioritized._priority._deadline) {
+            statistics._missedDeadlines++;
+        }
+        return std::move(prioritized._task);
+    }
+
+    // The tasks are distributed between the queues of the stream threads in the round-robin fashion, so the
+    // producers and the consumers contend only for the lock of a single queue.
+    void EnqueueLocal(Task task) {
+        auto& queue = *_localQueues[_nextQueue++ % _localQueues.size()];
+        {
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+        }
+        _pendingTasks++;
+        // the shared mutex is taken only to avoid the lost wake up of a thread that is going to sleep
+        if (_sleepingThreads > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool PopLocal(int queueId, Task& task) {
+        // the own queue goes first, then the oldest tasks are stolen from the queues of the other threads
+        const auto queuesNum = _localQueues.size();
+        for (size_t i = 0; i < queuesNum; ++i) {
+            auto& queue = *_localQueues[(queueId + i) % queuesNum];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                task = std::move(queue._tasks.front());
+                queue._tasks.pop_front();
+                _pendingTasks--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // In the work stealing mode the prioritized tasks are kept in the shared priority queue, it is served after
+    // the local queues that hold the tasks queued before the first scheduling hint
+    bool PopPrioritized(Task& task) {
+        if (!_usePriorityQueue) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_prioritizedTasks.empty()) {
+            return false;
+        }
+        task = PopQueuedTask();
+        _pendingTasks--;
+        return true;
+    }
+
+    void WorkStealingLoop(int queueId) {
+        for (;;) {
+            Task task;
+            if (PopLocal(queueId, task) || PopPrioritized(task)) {
+                Execute(task, *(_streams.local()));
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _sleepingThreads++;
+            _queueCondVar.wait(lock, [&] {
+                return _pendingTasks > 0 || _isStopped;
+            });
+            _sleepingThreads--;
+            // the remaining tasks are executed before the thread is stopped
+            if (_isStopped && _pendingTasks == 0) {
+                break;
+            }
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -286,6 +508,32 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    // prioritized mode, the queue is guarded by the shared mutex
+    std::atomic<bool> _usePriorityQueue{false};
+    struct PrioritizedTask {
+        Task _task;
+        std::chrono::steady_clock::time_point _key;  // the effective deadline
+        uint64_t _seq;                               // keeps the FIFO order of the tasks with equal keys
+        std::chrono::steady_clock::time_point _enqueueTime;
+        TaskPriority _priority;
+        bool _hasDeadline;
+        // the heap top is the task with the earliest effective deadline
+        bool operator<(const PrioritizedTask& other) const {
+            return _key != other._key ? _key > other._key : _seq > other._seq;
+        }
+    };
+    std::vector<PrioritizedTask> _prioritizedTasks;
+    uint64_t _prioritizedSeq = 0;
+    std::map<ov::hint::Priority, QueueStatistics> _queueStatistics;
+    // work stealing mode
+    struct LocalQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+    };
+    std::vector<std::unique_ptr<LocalQueue>> _localQueues;
+    std::atomic<std::size_t> _nextQueue{0};
+    std::atomic<int> _pendingTasks{0};
+    std::atomic<int> _sleepingThreads{0};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -336,4 +584,32 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::RunWithPriority(Task task, const TaskPriority& priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
+void CPUStreamsExecutor::ExecuteNested(const std::vector<Task>& tasks, int concurrency) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    auto arenas = _impl->_streams.local()->GetNestedArenas(tasks.size(), concurrency);
+    tbb::task_group group;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        group.run([&, i] {
+            arenas[i]->execute(tasks[i]);
+        });
+    }
+    group.wait();
+#else
+    IStreamsExecutor::ExecuteNested(tasks, concurrency);
+#endif
+}
+
+std::map<ov::hint::Priority, IStreamsExecutor::QueueStatistics> CPUStreamsExecutor::GetQueueStatistics() {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    return _impl->_queueStatistics;
+}
+
 }  // namespace InferenceEngine
@@ -124,7 +124,10 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._workStealing == config._workStealing &&
+            executorConfig._prioritized == config._prioritized &&
+            executorConfig._priorityAging == config._priorityAging)
             if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
                 executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
                 return executor;
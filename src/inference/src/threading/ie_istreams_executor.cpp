@@ -21,12 +21,27 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::RunWithPriority(Task task, const TaskPriority&) {
+    run(std::move(task));
+}
+
+void IStreamsExecutor::ExecuteNested(const std::vector<Task>& tasks, int) {
+    for (const auto& task : tasks) {
+        task();
+    }
+}
+
+std::map<ov::hint::Priority, IStreamsExecutor::QueueStatistics> IStreamsExecutor::GetQueueStatistics() {
+    return {};
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING),
         ov::num_streams.name(),
         ov::inference_num_threads.name(),
         ov::affinity.name(),
@@ -150,6 +165,15 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _workStealing = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _workStealing = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)
+                       << ". Expected only YES/NO";
+        }
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -188,6 +212,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) const {
         return decltype(ov::inference_num_threads)::value_type{_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        return {_workStealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
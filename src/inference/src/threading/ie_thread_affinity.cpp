@@ -18,7 +18,8 @@
 
 namespace InferenceEngine {
 #if !(defined(__APPLE__) || defined(_WIN32))
-std::tuple<CpuSet, int> GetProcessMask() {
+namespace {
+std::tuple<CpuSet, int> GetAffinityMask(pid_t pid) {
     for (int ncpus = sizeof(cpu_set_t) / CHAR_BIT; ncpus < 32768 /* reasonable limit of #cores*/; ncpus <<= 1) {
         CpuSet mask{CPU_ALLOC(ncpus)};
         if (nullptr == mask)
@@ -26,7 +27,7 @@ std::tuple<CpuSet, int> GetProcessMask() {
         const size_t size = CPU_ALLOC_SIZE(ncpus);
         CPU_ZERO_S(size, mask.get());
         // the result fits the mask
-        if (0 == sched_getaffinity(getpid(), size, mask.get())) {
+        if (0 == sched_getaffinity(pid, size, mask.get())) {
             return std::make_tuple(std::move(mask), ncpus);
         }
         // other error
@@ -35,6 +36,15 @@ std::tuple<CpuSet, int> GetProcessMask() {
     }
     return std::make_tuple(nullptr, 0);
 }
+}  // namespace
+
+std::tuple<CpuSet, int> GetProcessMask() {
+    return GetAffinityMask(getpid());
+}
+
+std::tuple<CpuSet, int> GetCurrentThreadMask() {
+    return GetAffinityMask(0);
+}
 
 /* Release the cores affinity mask for the current process */
 void ReleaseProcessMask(cpu_set_t* mask) {
@@ -102,6 +112,9 @@ bool PinCurrentThreadToSocket(int socket) {
 std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
 }
+std::tuple<CpuSet, int> GetCurrentThreadMask() {
+    return std::make_tuple(nullptr, 0);
+}
 void ReleaseProcessMask(cpu_set_t*) {}
 
 bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
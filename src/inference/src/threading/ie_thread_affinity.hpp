@@ -54,6 +54,13 @@ using CpuSet = std::unique_ptr<cpu_set_t, ReleaseProcessMaskDeleter>;
  */
 std::tuple<CpuSet, int> GetProcessMask();
 
+/**
+ * @brief Get the cores affinity mask of the current thread
+ * @ingroup ie_dev_api_threading
+ * @return A core affinity mask
+ */
+std::tuple<CpuSet, int> GetCurrentThreadMask();
+
 /**
  * @brief      Pins current thread to a set of cores determined by the mask
  * @ingroup    ie_dev_api_threading
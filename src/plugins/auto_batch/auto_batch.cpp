@@ -27,7 +27,28 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY(AUTO_BATCH_LATENCY_SLO),
+                                                 CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)};
+
+namespace {
+
+// exponential moving average for the online statistics of the adaptive timeout
+double updateAverage(double average, double value) {
+    constexpr double alpha = 0.1;
+    return average > 0 ? (1 - alpha) * average + alpha * value : value;
+}
+
+void updateExecutionTime(AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(workerRequest._statsMutex);
+    workerRequest._executionTime =
+        updateAverage(workerRequest._executionTime,
+                      std::chrono::duration<double, std::milli>(now - workerRequest._executionStart).count());
+}
+
+}  // namespace
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -333,13 +354,41 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+SoIInferRequestInternal& AutoBatchInferRequest::GetPartialBatchRequest() {
+    return _myBatchedRequestWrapper._partialBatchRequests.at(_partialBatchSize);
+}
+
+void AutoBatchInferRequest::CopyInputsToPartialBatch() {
+    auto& req = GetPartialBatchRequest();
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, _partialBatchId, _partialBatchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromPartialBatch() {
+    auto& req = GetPartialBatchRequest();
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, _partialBatchId, _partialBatchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +396,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -365,7 +414,11 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
     }
 }
 
@@ -381,6 +434,15 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
         explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto& workerInferRequest = _this->_inferRequest->_myBatchedRequestWrapper;
+            {
+                const auto now = std::chrono::steady_clock::now();
+                std::lock_guard<std::mutex> lock(workerInferRequest._statsMutex);
+                if (workerInferRequest._lastArrival.time_since_epoch().count())
+                    workerInferRequest._interArrivalTime = updateAverage(
+                        workerInferRequest._interArrivalTime,
+                        std::chrono::duration<double, std::milli>(now - workerInferRequest._lastArrival).count());
+                workerInferRequest._lastArrival = now;
+            }
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
@@ -403,6 +465,9 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
                       if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                           this->_inferRequest->_wasBatchedRequestUsed)
                           this->_inferRequest->CopyOutputsIfNeeded();
+                      else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED ==
+                               this->_inferRequest->_wasBatchedRequestUsed)
+                          this->_inferRequest->CopyOutputsFromPartialBatch();
                   }}};
 }
 
@@ -411,6 +476,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->GetPartialBatchRequest()->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -427,6 +494,7 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksForPartialBatch,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
@@ -435,6 +503,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksForPartialBatch{networksForPartialBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -442,7 +511,11 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     _device = networkDevice;
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
-    _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    _timeOut = ParseTimeoutValue(time_out->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    _effectiveTimeOut = _timeOut.load();
+    auto latency_slo = config.find(CONFIG_KEY(AUTO_BATCH_LATENCY_SLO));
+    if (latency_slo != config.end())
+        _latencySLO = ParseTimeoutValue(latency_slo->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_LATENCY_SLO));
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -453,13 +526,39 @@ AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
     _workerRequests.clear();
 }
 
-unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s) {
+unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s, const std::string& key) {
     auto val = std::stoi(s);
     if (val < 0)
-        IE_THROW(ParameterMismatch) << "Value for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " should be unsigned int";
+        IE_THROW(ParameterMismatch) << "Value for the " << key << " should be unsigned int";
     return val;
 }
 
+unsigned int AutoBatchExecutableNetwork::GetTimeOut(WorkerInferRequest& workerRequest) {
+    const int timeOut = _timeOut;
+    const int latencySLO = _latencySLO;
+    if (!latencySLO)
+        return timeOut;
+    double interArrivalTime, executionTime;
+    {
+        std::lock_guard<std::mutex> lock(workerRequest._statsMutex);
+        interArrivalTime = workerRequest._interArrivalTime;
+        executionTime = workerRequest._executionTime;
+    }
+    // the requests can be collected only for the time that the batch execution leaves from the SLO
+    double timeOutForSLO = std::min<double>(timeOut, std::max(0.0, latencySLO - executionTime));
+    if (interArrivalTime > 0) {
+        // no need to wait longer than the full batch takes to arrive (with the margin for the arrivals jitter)
+        timeOutForSLO = std::min(timeOutForSLO, 1.5 * interArrivalTime * (workerRequest._batchSize - 1));
+        // if the next request is not expected within the time, the waiting just adds to the latency
+        if (interArrivalTime > timeOutForSLO)
+            timeOutForSLO = 0;
+    }
+    // the zero timeout would turn the waiting into the busy loop
+    const unsigned int effectiveTimeOut = std::max(1, static_cast<int>(timeOutForSLO));
+    _effectiveTimeOut = effectiveTimeOut;
+    return effectiveTimeOut;
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _networkWithoutBatch->GetContext();
 }
@@ -502,8 +601,12 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        for (const auto& network : _networksForPartialBatch)
+            workerRequestPtr->_partialBatchRequests[network.first] = {network.second->CreateInferRequest(),
+                                                                      network.second._so};
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
+                updateExecutionTime(*workerRequestPtr);
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
@@ -520,7 +623,8 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    const auto timeOut = std::chrono::milliseconds(GetTimeOut(*workerRequestPtr));
+                    status = workerRequestPtr->_cond.wait_for(lock, timeOut);
                 }
                 if (_terminate) {
                     break;
@@ -528,6 +632,10 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = workerRequestPtr->_tasks.size();
+                    if (sz == workerRequestPtr->_batchSize || ((status == std::cv_status::timeout) && sz)) {
+                        _numCollectedBatches++;
+                        _numCollectedRequests += sz;
+                    }
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         for (int n = 0; n < sz; n++) {
@@ -537,30 +645,62 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_executionStart = std::chrono::steady_clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
+                        // timeout to collect the batch is over, have to execute the collected requests with the
+                        // smallest batch that fits them or (if there is no such) in the batch1 mode
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                        auto& partialBatchRequests = workerRequestPtr->_partialBatchRequests;
+                        const auto partial = sz > 1 ? partialBatchRequests.lower_bound(sz) : partialBatchRequests.end();
+                        if (partial != partialBatchRequests.end()) {
+                            // the partial batch requests do not share the blobs with the individual requests,
+                            // so the data is copied to/from the slots of the batch (the rest of it is not used)
+                            std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(sz);
+                            for (int n = 0; n < sz; n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
+                                auto& inferRequest = tasks[n].first->_inferRequest;
+                                inferRequest->_partialBatchId = n;
+                                inferRequest->_partialBatchSize = partial->first;
+                                inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                                inferRequest->CopyInputsToPartialBatch();
+                            }
+                            partial->second->SetCallback([&tasks, &all_completed, workerRequestPtr](
+                                                             std::exception_ptr p) {
+                                updateExecutionTime(*workerRequestPtr);
+                                for (auto& t : tasks) {
                                     if (p)
                                         t.first->_inferRequest->_exceptionPtr = p;
                                     t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
+                                }
+                                all_completed.set_value();
+                            });
+                            workerRequestPtr->_executionStart = std::chrono::steady_clock::now();
+                            partial->second->StartAsync();
+                            all_completed_future.get();
+                        } else {
+                            std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                            // popping all tasks collected by the moment of the time-out and execute each with batch1
+                            std::atomic<int> arrived = {0};
+                            for (int n = 0; n < sz; n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                                t.first->_inferRequestWithoutBatch->SetCallback(
+                                    [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                        if (p)
+                                            t.first->_inferRequest->_exceptionPtr = p;
+                                        t.second();
+                                        if (sz == ++arrived)
+                                            all_completed.set_value();
+                                    });
+                                t.first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                                t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+                                t.first->_inferRequestWithoutBatch->StartAsync();
+                            }
+                            all_completed_future.get();
                         }
-                        all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -598,12 +738,16 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
     auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == config.end() || config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
-        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
+    auto latency_slo = config.find(CONFIG_KEY(AUTO_BATCH_LATENCY_SLO));
+    if (config.empty() || config.size() > static_cast<size_t>(timeout != config.end()) +
+                                             static_cast<size_t>(latency_slo != config.end())) {
+        IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and the " << CONFIG_KEY(AUTO_BATCH_LATENCY_SLO);
     }
+    if (timeout != config.end())
+        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    if (latency_slo != config.end())
+        _latencySLO = ParseTimeoutValue(latency_slo->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_LATENCY_SLO));
 }
 
 InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string& name) const {
@@ -638,15 +782,26 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, reqs);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT)) {
+        const unsigned int timeOut = _latencySLO ? _effectiveTimeOut : _timeOut;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_EFFECTIVE_TIMEOUT, timeOut);
+    } else if (name == METRIC_KEY(AUTO_BATCH_FILL)) {
+        const uint64_t batches = _numCollectedBatches;
+        const float fill =
+            batches ? static_cast<float>(_numCollectedRequests) / (batches * _device.batchForDevice) : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_FILL, fill);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS,
                              {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+                              METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT),
+                              METRIC_KEY(AUTO_BATCH_FILL)});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        // only the timeout and the latency SLO can be changed on the fly
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), CONFIG_KEY(AUTO_BATCH_LATENCY_SLO)});
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -752,15 +907,17 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == CONFIG_KEY(AUTO_BATCH_LATENCY_SLO)) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception& e) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
+        } else if (name == CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for " << name << " got " << val;
         }
     }
 }
@@ -778,6 +935,8 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY(AUTO_BATCH_LATENCY_SLO)] = "0";  // no SLO (the timeout is not adaptive) by default
+    _config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(NO);  // timed-out requests are executed with batch1
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -947,23 +1106,42 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    auto loadNetworkWithBatch = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
+    // the (optional) ladder of the batch sizes (2, 4, ... and the batchForDevice itself) to execute the requests
+    // collected by the timeout with the smallest batch that fits them, rather than one by one with the batch1
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> networksForPartialBatch;
+    const auto partialBatches = fullConfig.find(CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES));
+    if (executableNetworkWithBatch && partialBatches != fullConfig.end() &&
+        partialBatches->second == CONFIG_VALUE(YES)) {
+        networksForPartialBatch[metaDevice.batchForDevice] = executableNetworkWithBatch;
+        for (int batch = 2; batch < metaDevice.batchForDevice; batch *= 2) {
+            try {
+                networksForPartialBatch[batch] = loadNetworkWithBatch(batch);
+            } catch (...) {
+                // the requests are executed with the next (larger) batch from the ladder
+            }
+        }
+    }
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
+                                                        networksForPartialBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
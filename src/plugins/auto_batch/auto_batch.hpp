@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -37,17 +38,26 @@ public:
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
         int _batchSize;
+        // requests of the batch sizes ladder (up to the _batchSize), to execute the partially collected batch
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _partialBatchRequests;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // exponentially averaged requests inter-arrival time and batch execution time (in ms), for the adaptive timeout
+        std::mutex _statsMutex;
+        std::chrono::steady_clock::time_point _lastArrival;
+        std::chrono::steady_clock::time_point _executionStart;
+        double _interArrivalTime = 0;
+        double _executionTime = 0;
     };
 
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksForPartialBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
@@ -68,11 +78,13 @@ public:
     virtual ~AutoBatchExecutableNetwork();
 
 protected:
-    static unsigned int ParseTimeoutValue(const std::string&);
+    static unsigned int ParseTimeoutValue(const std::string& value, const std::string& key);
+    unsigned int GetTimeOut(WorkerInferRequest& workerRequest);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksForPartialBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -82,6 +94,10 @@ protected:
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    std::atomic_int _latencySLO = {0};  // in ms, enables the adaptive timeout if non-zero
+    std::atomic_int _effectiveTimeOut = {0};  // in ms
+    std::atomic<uint64_t> _numCollectedBatches = {0};
+    std::atomic<uint64_t> _numCollectedRequests = {0};
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -109,16 +125,27 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // Batch-Device impl specific: copies the data to/from the (_partialBatchId) slot of the partial batch request
+    void CopyInputsToPartialBatch();
+    void CopyOutputsFromPartialBatch();
+    InferenceEngine::SoIInferRequestInternal& GetPartialBatchRequest();
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    size_t _partialBatchId = 0;
+    int _partialBatchSize = 0;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
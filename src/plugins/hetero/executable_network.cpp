@@ -850,6 +850,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE) || name == HETERO_CONFIG_KEY(COST_BASED_PARTITIONING)) {
+        auto it = _config.find(name);
+        result = it != _config.end() && it->second == YES;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -930,6 +933,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE),
+                                                     HETERO_CONFIG_KEY(COST_BASED_PARTITIONING),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -951,10 +956,14 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+        const bool pipeline = itPipeline != _config.end() && itPipeline->second == YES;
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto subnetworkValue =
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            // in the pipelined mode each subgraph (stage) works on its own requests, so all the stages are kept busy
+            value = pipeline ? value + subnetworkValue : std::max(value, subnetworkValue);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else {
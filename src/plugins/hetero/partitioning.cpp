@@ -0,0 +1,388 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "partitioning.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+#include "ngraph/op/util/op_types.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
+
+namespace HeteroPlugin {
+
+namespace {
+
+using Cost = int64_t;
+
+constexpr Cost infiniteCost = std::numeric_limits<Cost>::max() / 4;
+// the costs are in the units of the nodes work (the multiply-add operations):
+// the transfer of the tensor element between the subgraphs and the fixed cost of each subgraphs boundary
+// (the synchronization and the start of the next infer request)
+constexpr Cost transferCostPerElement = 4;
+constexpr Cost boundaryCost = 100000;
+constexpr int maxSwapIterations = 8;
+
+Cost elementsCount(const ov::PartialShape& shape) {
+    Cost count = 1;
+    if (shape.rank().is_dynamic()) {
+        return count;
+    }
+    for (auto&& dim : shape) {
+        if (dim.is_static()) {
+            count *= dim.get_length();
+        }
+    }
+    return count;
+}
+
+// the number of the output elements multiplied by the reduction size for the convolutions and the matrix
+// multiplications
+Cost estimateWork(const ov::Node& node) {
+    Cost work = 0;
+    for (auto&& output : node.outputs()) {
+        work += elementsCount(output.get_partial_shape());
+    }
+    Cost reduction = 1;
+    size_t firstReducedDim = 0;
+    if (ov::is_type<ov::op::v1::Convolution>(&node)) {
+        // weights layout [C_OUT, C_IN, kernel...]
+        firstReducedDim = 1;
+    } else if (ov::is_type<ov::op::v1::GroupConvolution>(&node)) {
+        // weights layout [GROUPS, C_OUT, C_IN, kernel...]
+        firstReducedDim = 2;
+    }
+    if (firstReducedDim) {
+        const auto& weights = node.get_input_partial_shape(1);
+        if (weights.rank().is_static()) {
+            for (size_t i = firstReducedDim; i < weights.size(); ++i) {
+                if (weights[i].is_static()) {
+                    reduction *= weights[i].get_length();
+                }
+            }
+        }
+    } else if (auto matMul = ov::as_type<const ov::op::v0::MatMul>(&node)) {
+        const auto& input = node.get_input_partial_shape(0);
+        if (input.rank().is_static() && input.size()) {
+            const auto reducedDim = input.size() > 1 && matMul->get_transpose_a() ? input.size() - 2 : input.size() - 1;
+            const auto& dim = input[reducedDim];
+            if (dim.is_static()) {
+                reduction = dim.get_length();
+            }
+        }
+    }
+    return std::max<Cost>(1, work * reduction);
+}
+
+// Dinic maximal flow, the minimal cut is the source side of the residual network
+class MaxFlow {
+public:
+    explicit MaxFlow(size_t nodes) : _graph(nodes), _level(nodes), _next(nodes) {}
+
+    void AddEdge(size_t from, size_t to, Cost capacity, Cost reverseCapacity = 0) {
+        _graph[from].push_back({to, _graph[to].size(), capacity});
+        _graph[to].push_back({from, _graph[from].size() - 1, reverseCapacity});
+    }
+
+    void Run(size_t source, size_t sink) {
+        while (BuildLevels(source, sink)) {
+            std::fill(_next.begin(), _next.end(), 0);
+            while (Augment(source, sink)) {
+            }
+        }
+    }
+
+    std::vector<bool> SourceSide(size_t source) const {
+        std::vector<bool> visited(_graph.size(), false);
+        std::queue<size_t> queue;
+        visited[source] = true;
+        queue.push(source);
+        while (!queue.empty()) {
+            auto node = queue.front();
+            queue.pop();
+            for (auto&& edge : _graph[node]) {
+                if (edge.capacity > 0 && !visited[edge.to]) {
+                    visited[edge.to] = true;
+                    queue.push(edge.to);
+                }
+            }
+        }
+        return visited;
+    }
+
+private:
+    struct Edge {
+        size_t to;
+        size_t reverse;
+        Cost capacity;
+    };
+
+    bool BuildLevels(size_t source, size_t sink) {
+        std::fill(_level.begin(), _level.end(), -1);
+        std::queue<size_t> queue;
+        _level[source] = 0;
+        queue.push(source);
+        while (!queue.empty()) {
+            auto node = queue.front();
+            queue.pop();
+            for (auto&& edge : _graph[node]) {
+                if (edge.capacity > 0 && _level[edge.to] < 0) {
+                    _level[edge.to] = _level[node] + 1;
+                    queue.push(edge.to);
+                }
+            }
+        }
+        return _level[sink] >= 0;
+    }
+
+    // pushes the flow along a single path of the level network, the search is iterative as the paths can be as long
+    // as the network itself
+    Cost Augment(size_t source, size_t sink) {
+        std::vector<std::pair<size_t, size_t>> path;
+        auto node = source;
+        while (node != sink) {
+            auto& next = _next[node];
+            while (next < _graph[node].size() &&
+                   !(_graph[node][next].capacity > 0 && _level[_graph[node][next].to] == _level[node] + 1)) {
+                ++next;
+            }
+            if (next < _graph[node].size()) {
+                path.emplace_back(node, next);
+                node = _graph[node][next].to;
+            } else {
+                // dead end, it is excluded from the level network
+                _level[node] = -1;
+                if (path.empty()) {
+                    return 0;
+                }
+                node = path.back().first;
+                path.pop_back();
+                ++_next[node];
+            }
+        }
+        Cost flow = infiniteCost;
+        for (auto&& step : path) {
+            flow = std::min(flow, _graph[step.first][step.second].capacity);
+        }
+        for (auto&& step : path) {
+            auto& edge = _graph[step.first][step.second];
+            edge.capacity -= flow;
+            _graph[edge.to][edge.reverse].capacity += flow;
+        }
+        return flow;
+    }
+
+    std::vector<std::vector<Edge>> _graph;
+    std::vector<int> _level;
+    std::vector<size_t> _next;
+};
+
+// the slowdown of each device relative to the fastest one for the nodes of the precision, the precisions the devices
+// do not report the throughput for are estimated as the f32 ones
+std::vector<double> devicesSlowdown(const DeviceProfiles& devices, const ov::element::Type& precision) {
+    std::vector<double> gops;
+    for (auto&& device : devices) {
+        auto itGops = device.gops.find(precision);
+        if (itGops == device.gops.end()) {
+            itGops = device.gops.find(ov::element::f32);
+        }
+        if (itGops == device.gops.end() || itGops->second <= 0.f) {
+            break;
+        }
+        gops.push_back(itGops->second);
+    }
+    // without the throughput of every device the priorities are the only estimate
+    const bool profiled = !devices.empty() && gops.size() == devices.size();
+    const double fastest = profiled ? *std::max_element(gops.begin(), gops.end()) : 0.;
+    std::vector<double> slowdown(devices.size());
+    for (size_t device = 0; device < devices.size(); ++device) {
+        slowdown[device] = (profiled ? fastest / gops[device] : static_cast<double>(device + 1)) *
+                           std::max(1u, devices[device].streams);
+    }
+    return slowdown;
+}
+
+struct Neighbour {
+    size_t node;
+    Cost cost;
+};
+
+}  // namespace
+
+std::map<std::string, std::string> PartitionByCost(const std::shared_ptr<const ov::Model>& model,
+                                                   const DeviceProfiles& devices) {
+    const auto orderedOps = model->get_ordered_ops();
+    const auto devicesCount = devices.size();
+
+    // the graph of the nodes to assign (all but the results that follow their producers), the parameters and the
+    // constants have no work, so only the transfers of their values matter
+    std::vector<std::shared_ptr<ov::Node>> nodes;
+    std::unordered_map<const ov::Node*, size_t> nodeIds;
+    std::vector<std::vector<Cost>> computeCosts;
+    std::map<ov::element::Type, std::vector<double>> slowdowns;
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_output(node)) {
+            continue;
+        }
+        const bool hasWork = !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node);
+        const auto work = hasWork ? estimateWork(*node) : 0;
+        const auto precision = node->get_input_size() ? node->get_input_element_type(0)
+                                                      : node->get_output_element_type(0);
+        auto itSlowdown = slowdowns.find(precision);
+        if (itSlowdown == slowdowns.end()) {
+            itSlowdown = slowdowns.emplace(precision, devicesSlowdown(devices, precision)).first;
+        }
+        std::vector<Cost> costs(devicesCount, infiniteCost);
+        bool supported = false;
+        for (size_t device = 0; device < devicesCount; ++device) {
+            if (devices[device].queryResult.supportedLayersMap.count(node->get_friendly_name())) {
+                costs[device] =
+                    hasWork ? std::max<Cost>(1, std::llround(work * itSlowdown->second[device])) : Cost{0};
+                supported = true;
+            }
+        }
+        if (supported) {
+            nodeIds.emplace(node.get(), nodes.size());
+            nodes.push_back(node);
+            computeCosts.push_back(std::move(costs));
+        }
+    }
+
+    std::vector<std::vector<Neighbour>> neighbours(nodes.size());
+    for (size_t id = 0; id < nodes.size(); ++id) {
+        for (auto&& input : nodes[id]->inputs()) {
+            auto source = input.get_source_output();
+            auto itSource = nodeIds.find(source.get_node());
+            if (itSource != nodeIds.end()) {
+                const auto cost = transferCostPerElement * elementsCount(source.get_partial_shape()) + boundaryCost;
+                neighbours[id].push_back({itSource->second, cost});
+                neighbours[itSource->second].push_back({id, cost});
+            }
+        }
+    }
+
+    auto energy = [&](const std::vector<size_t>& labels) {
+        Cost result = 0;
+        for (size_t id = 0; id < nodes.size(); ++id) {
+            result += computeCosts[id][labels[id]];
+            for (auto&& neighbour : neighbours[id]) {
+                // each edge is visited from both sides
+                if (neighbour.node < id && labels[neighbour.node] != labels[id]) {
+                    result += neighbour.cost;
+                }
+            }
+        }
+        return result;
+    };
+
+    // the initial assignment is to the first device (by priority) supporting the node
+    std::vector<size_t> labels(nodes.size());
+    for (size_t id = 0; id < nodes.size(); ++id) {
+        labels[id] = std::find_if(computeCosts[id].begin(),
+                                  computeCosts[id].end(),
+                                  [](Cost cost) {
+                                      return cost < infiniteCost;
+                                  }) -
+                     computeCosts[id].begin();
+    }
+    auto labelsEnergy = energy(labels);
+
+    bool improved = true;
+    for (int iteration = 0; improved && iteration < maxSwapIterations; ++iteration) {
+        improved = false;
+        for (size_t a = 0; a < devicesCount; ++a) {
+            for (size_t b = a + 1; b < devicesCount; ++b) {
+                // the nodes assigned to either of the devices are re-assigned by the minimal cut: the source side of
+                // the cut is for the device "a", the sink side is for the device "b"
+                std::vector<size_t> members;
+                std::vector<size_t> memberIds(nodes.size(), std::numeric_limits<size_t>::max());
+                for (size_t id = 0; id < nodes.size(); ++id) {
+                    if (labels[id] == a || labels[id] == b) {
+                        memberIds[id] = members.size();
+                        members.push_back(id);
+                    }
+                }
+                if (members.empty()) {
+                    continue;
+                }
+                const auto source = members.size();
+                const auto sink = source + 1;
+                MaxFlow flow(members.size() + 2);
+                for (size_t member = 0; member < members.size(); ++member) {
+                    const auto id = members[member];
+                    auto costA = computeCosts[id][a];
+                    auto costB = computeCosts[id][b];
+                    for (auto&& neighbour : neighbours[id]) {
+                        if (memberIds[neighbour.node] != std::numeric_limits<size_t>::max()) {
+                            if (neighbour.node < id) {
+                                flow.AddEdge(memberIds[neighbour.node], member, neighbour.cost, neighbour.cost);
+                            }
+                            continue;
+                        }
+                        // the neighbours assigned to the other devices make a boundary for either choice
+                        if (costA < infiniteCost && labels[neighbour.node] != a) {
+                            costA += neighbour.cost;
+                        }
+                        if (costB < infiniteCost && labels[neighbour.node] != b) {
+                            costB += neighbour.cost;
+                        }
+                    }
+                    flow.AddEdge(source, member, costB);
+                    flow.AddEdge(member, sink, costA);
+                }
+                flow.Run(source, sink);
+                const auto sourceSide = flow.SourceSide(source);
+                auto newLabels = labels;
+                for (size_t member = 0; member < members.size(); ++member) {
+                    newLabels[members[member]] = sourceSide[member] ? a : b;
+                }
+                const auto newEnergy = energy(newLabels);
+                if (newEnergy < labelsEnergy) {
+                    labels = std::move(newLabels);
+                    labelsEnergy = newEnergy;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    std::map<std::string, std::string> affinities;
+    for (size_t id = 0; id < nodes.size(); ++id) {
+        affinities.emplace(nodes[id]->get_friendly_name(), devices[labels[id]].name);
+    }
+    for (auto&& node : orderedOps) {
+        if (affinities.count(node->get_friendly_name())) {
+            continue;
+        }
+        if (ngraph::op::is_output(node)) {
+            auto itAffinity = affinities.find(node->get_input_node_ptr(0)->get_friendly_name());
+            if (itAffinity != affinities.end()) {
+                affinities.emplace(node->get_friendly_name(), itAffinity->second);
+            }
+        } else if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node)) {
+            // the parameters and the constants unsupported by all the devices go to the device of the most of the
+            // consumers, the first one by priority if there are several
+            std::vector<size_t> consumers(devicesCount, 0);
+            for (auto&& input : node->output(0).get_target_inputs()) {
+                auto itConsumer = nodeIds.find(input.get_node());
+                if (itConsumer != nodeIds.end()) {
+                    ++consumers[labels[itConsumer->second]];
+                }
+            }
+            auto itMost = std::max_element(consumers.begin(), consumers.end());
+            if (itMost != consumers.end() && *itMost) {
+                affinities.emplace(node->get_friendly_name(), devices[itMost - consumers.begin()].name);
+            }
+        }
+    }
+    return affinities;
+}
+
+}  // namespace HeteroPlugin
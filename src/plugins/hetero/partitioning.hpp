@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the cost-based partitioning of the network between the devices
+ * @file partitioning.hpp
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ie_common.h"
+#include "openvino/core/model.hpp"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief The device the network is partitioned to
+ */
+struct DeviceProfile {
+    std::string name;                                 //!< The device name
+    InferenceEngine::QueryNetworkResult queryResult;  //!< The nodes supported by the device
+    std::map<ov::element::Type, float> gops;          //!< The device throughput (see ov::device::gops), empty if unknown
+    unsigned int streams = 1;                         //!< The number of the streams the device is shared by
+};
+
+/**
+ * @brief Profiles of the devices, in the order of the devices priorities
+ */
+using DeviceProfiles = std::vector<DeviceProfile>;
+
+/**
+ * @brief Assigns the nodes to the devices minimizing the estimated execution time of the nodes on the devices
+ * plus the cost of the data transfers between the subgraphs.
+ * The costs are static estimates rather than the profiled timings. The node work is the number of the output
+ * elements (multiplied by the reduction size for the convolutions and the matrix multiplications), it is divided by
+ * the throughput the device reports for the node precision relative to the fastest device. When any of the devices
+ * does not report the throughput for the precision, the device at the position i of the priorities is assumed to be
+ * (i + 1) times slower than the first one instead. A single request gets the 1/N of the device configured with N
+ * streams, so the work is multiplied by the number of the streams as well.
+ * The parameters and the constants are the nodes without the work, so they are placed where the transfers of their
+ * values are the cheapest (i.e. with the consumers of the most of the data), the results follow their producers.
+ * The nodes are assigned with the alpha-beta swap moves, each of them is the exact minimal cut for a pair of the
+ * devices.
+ * @param model the network to partition
+ * @param devices the profiles of the devices
+ * @return the device for each node (by the friendly name) supported by any of the devices
+ */
+std::map<std::string, std::string> PartitionByCost(const std::shared_ptr<const ov::Model>& model,
+                                                   const DeviceProfiles& devices);
+
+}  // namespace HeteroPlugin
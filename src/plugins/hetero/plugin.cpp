@@ -13,7 +13,9 @@
 #include <fstream>
 #include <unordered_set>
 #include "ie_plugin_config.hpp"
+#include "ie_ngraph_utils.hpp"
 #include "executable_network.hpp"
+#include "partitioning.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <openvino/runtime/properties.hpp>
 // clang-format on
@@ -27,6 +29,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE)] = NO;
+    _config[HETERO_CONFIG_KEY(COST_BASED_PARTITIONING)] = NO;
 }
 
 namespace {
@@ -40,6 +44,8 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINE),
+                                                                  HETERO_CONFIG_KEY(COST_BASED_PARTITIONING),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -91,7 +97,14 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
             tconfig[KEY_DEVICE_ID] = deviceIDLocal;
         }
 
-        return GetCore()->GetSupportedConfig(deviceName, tconfig);
+        auto deviceConfig = GetCore()->GetSupportedConfig(deviceName, tconfig);
+        // the pipelined subgraphs are executed concurrently, so the devices should not mux them into a single queue
+        auto itPipeline = tconfig.find(HETERO_CONFIG_KEY(PIPELINE));
+        if (itPipeline != tconfig.end() && itPipeline->second == YES &&
+            deviceConfig.find(KEY_EXCLUSIVE_ASYNC_REQUESTS) != deviceConfig.end()) {
+            deviceConfig[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
+        }
+        return deviceConfig;
     };
 
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(targetFallback);
@@ -140,18 +153,36 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
         IE_THROW() << "HETERO device supports just ngraph network representation";
     }
 
-    std::map<std::string, QueryNetworkResult> queryResults;
-    for (auto&& metaDevice : metaDevices) {
-        auto& deviceName = metaDevice.first;
-        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.second);
-    }
-
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    // the repeated names (e.g. HETERO:CPU,CPU) address the same device, so it is queried (and gets the nodes) once;
+    // the separate instances of a device are to be registered under their own names (e.g. CPU0 and CPU1)
+    DeviceProfiles devices;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+        auto itDevice = std::find_if(devices.begin(), devices.end(), [&](const DeviceProfile& device) {
+            return device.name == deviceName;
+        });
+        if (itDevice == devices.end()) {
+            DeviceProfile device;
+            device.name = deviceName;
+            device.queryResult = GetCore()->QueryNetwork(network, deviceName, metaDevices[deviceName]);
+            devices.push_back(std::move(device));
+        }
+    }
+
+    auto itCostBased = tconfig.find(HETERO_CONFIG_KEY(COST_BASED_PARTITIONING));
+    if (itCostBased != tconfig.end() && itCostBased->second == YES) {
+        for (auto&& device : devices) {
+            device.gops = DeviceGops(device.name);
+            device.streams = DeviceStreams(device.name, metaDevices[device.name]);
+        }
+        qr.supportedLayersMap = PartitionByCost(function, devices);
+    } else {
+        for (auto&& device : devices) {
+            for (auto&& layerQueryResult : device.queryResult.supportedLayersMap) {
+                qr.supportedLayersMap.emplace(layerQueryResult);
+            }
         }
     }
 
@@ -213,12 +244,72 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
     return resArch;
 }
 
+// the throughput the device reports for the precisions, empty if it does not
+std::map<ov::element::Type, float> Engine::DeviceGops(const std::string& device) const {
+    std::map<ov::element::Type, float> gops;
+    InferenceEngine::DeviceIDParser parser(device);
+    auto supportedMetricKeys =
+        GetCore()->GetMetric(parser.getDeviceName(), METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    if (std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), METRIC_KEY(DEVICE_GOPS)) ==
+        supportedMetricKeys.end()) {
+        return gops;
+    }
+    auto metric = GetCore()->GetMetric(device, METRIC_KEY(DEVICE_GOPS));
+    if (metric.is<std::map<ov::element::Type, float>>()) {
+        return metric.as<std::map<ov::element::Type, float>>();
+    }
+    for (auto&& precisionGops : metric.as<std::map<Precision, float>>()) {
+        gops.emplace(details::convertPrecision(precisionGops.first), precisionGops.second);
+    }
+    return gops;
+}
+
+// the number of the streams set in the device config or by default, 1 if it is not known until the compilation
+// (e.g. AUTO, or the performance hints)
+unsigned int Engine::DeviceStreams(const std::string& device, const Configs& deviceConfig) const {
+    static const std::vector<std::string> streamsKeys = {ov::num_streams.name(),
+                                                         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
+                                                         CONFIG_KEY(GPU_THROUGHPUT_STREAMS)};
+    auto toStreams = [](const std::string& value) {
+        try {
+            return static_cast<unsigned int>(std::max(1, std::stoi(value)));
+        } catch (const std::exception&) {
+            return 1u;
+        }
+    };
+    for (auto&& key : streamsKeys) {
+        auto it = deviceConfig.find(key);
+        if (it != deviceConfig.end()) {
+            return toStreams(it->second);
+        }
+    }
+    InferenceEngine::DeviceIDParser parser(device);
+    auto supportedConfigKeys =
+        GetCore()->GetMetric(parser.getDeviceName(), METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
+    for (auto&& key : streamsKeys) {
+        if (std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(), key) != supportedConfigKeys.end()) {
+            return toStreams(GetCore()->GetConfig(device, key).as<std::string>());
+        }
+    }
+    return 1;
+}
+
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
     if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
         auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+        IE_ASSERT(it != _config.end());
+        bool pipeline = it->second == YES;
+        return {pipeline};
+    } else if (name == HETERO_CONFIG_KEY(COST_BASED_PARTITIONING)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(COST_BASED_PARTITIONING));
+        IE_ASSERT(it != _config.end());
+        bool costBased = it->second == YES;
+        return {costBased};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -49,5 +49,7 @@ public:
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string& deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
+    std::map<ov::element::Type, float> DeviceGops(const std::string& device) const;
+    unsigned int DeviceStreams(const std::string& device, const Configs& deviceConfig) const;
 };
 }  // namespace HeteroPlugin
@@ -74,9 +74,26 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_evictions;
         }
     }
 
+    /**
+     * @brief Returns the number of records currently stored in the cache
+     * @return the number of records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache since its creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const noexcept {
+        return _evictions;
+    }
+
     /**
      * @brief Returns the current capacity value
      * @return the current capacity value
@@ -102,6 +119,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    size_t _evictions = 0;
 };
 
 }   // namespace intel_cpu
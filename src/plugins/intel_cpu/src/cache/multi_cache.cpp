@@ -8,6 +8,20 @@ namespace ov {
 namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
+std::mutex MultiCache::_sharedMutex;
+
+CacheStatistics MultiCache::getStatistics() const {
+    if (_shared) {
+        return _shared->getStatistics();
+    }
+
+    CacheStatistics stats;
+    std::lock_guard<std::mutex> lock(_sharedMutex);
+    for (const auto& entry : _storage) {
+        stats += entry.second->getStatistics();
+    }
+    return stats;
+}
 
 }   // namespace intel_cpu
 }   // namespace ov
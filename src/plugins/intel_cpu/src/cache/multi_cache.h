@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,13 +17,18 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The entries (one per Key/Value types pair) are thread safe, so they may be shared between several MultiCache instances:
+ * a MultiCache created on top of another one is a view that keeps its own lookup table of the entries and takes
+ * the entries from the shared cache. It allows all the streams of a compiled model to use the same runtime cache,
+ * while each stream looks up the entries without locking.
+ *
+ * @attention The lookup table of the entries IS NOT THREAD SAFE, so each thread must use its own MultiCache view!
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -33,6 +40,12 @@ public:
     */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+    * @brief Creates a view of the shared cache. All the entries are taken from the shared cache.
+    * @param shared is the cache whose entries are shared
+    */
+    explicit MultiCache(std::shared_ptr<MultiCache> shared) : _capacity(shared->_capacity), _shared(std::move(shared)) {}
+
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
     *       using the key and the builder functor and adds the new record to the cache
@@ -49,16 +62,25 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the statistics accumulated over all the entries (of the shared cache in case of a view)
+    */
+    CacheStatistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
     template<typename KeyType, typename ValueType>
     EntryPtr<KeyType, ValueType> getEntry();
+    template<typename KeyType, typename ValueType>
+    EntryPtr<KeyType, ValueType> getSharedEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    std::shared_ptr<MultiCache> _shared;
+    static std::mutex _sharedMutex;
 };
 
 template<typename T>
@@ -73,12 +95,19 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        EntryBasePtr entry = _shared ? _shared->getSharedEntry<KeyType, ValueType>() : std::make_shared<EntryType>(_capacity);
+        auto result = _storage.insert({id, entry});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
 }
 
+template<typename KeyType, typename ValueType>
+MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getSharedEntry() {
+    std::lock_guard<std::mutex> lock(_sharedMutex);
+    return getEntry<KeyType, ValueType>();
+}
+
 using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shapes_history.h"
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+template <typename T>
+void hashCombine(size_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// record layout: <inputs number> { <name length> <name> <rank> <dims...> }
+void writeRecord(std::ostream& out, const ShapesHistory::InputShapes& shapes) {
+    out << shapes.size() << '\n';
+    for (const auto& input : shapes) {
+        out << input.first.size() << ' ' << input.first << ' ' << input.second.size();
+        for (const auto dim : input.second)
+            out << ' ' << dim;
+        out << '\n';
+    }
+}
+
+// the file is not trusted, the sizes are bounded before anything is allocated for them
+constexpr size_t maxInputsNum = 4096;
+constexpr size_t maxNameLength = 4096;
+constexpr size_t maxRank = 64;
+
+bool readRecord(std::istream& in, ShapesHistory::InputShapes& shapes) {
+    size_t inputsNum = 0;
+    in >> inputsNum;
+    if (!in || inputsNum > maxInputsNum)
+        return false;
+    for (size_t i = 0; i < inputsNum; ++i) {
+        size_t nameLength = 0;
+        in >> nameLength;
+        if (!in || nameLength > maxNameLength || in.get() != ' ')
+            return false;
+        std::string name(nameLength, '\0');
+        in.read(&name[0], nameLength);
+        if (!in)
+            return false;
+        size_t rank = 0;
+        in >> rank;
+        if (!in || rank > maxRank)
+            return false;
+        VectorDims dims(rank);
+        for (auto& dim : dims) {
+            in >> dim;
+            if (!in)
+                return false;
+        }
+        if (!shapes.emplace(std::move(name), std::move(dims)).second)
+            return false;
+    }
+    return true;
+}
+}   // namespace
+
+ShapesHistory::ShapesHistory(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model) {
+    if (cacheDir.empty())
+        return;
+    _filePath = cacheDir;
+    if (_filePath.back() != '/' && _filePath.back() != '\\')
+        _filePath += '/';
+    _filePath += "cpu_shapes_" + computeModelId(model) + ".txt";
+    load();
+}
+
+void ShapesHistory::load() {
+    std::ifstream in(_filePath);
+    if (!in.is_open())
+        return;
+
+    InputShapes shapes;
+    while (_records.size() < maxRecords && !(in >> std::ws).eof()) {
+        if (!readRecord(in, shapes)) {
+            // the file is broken (e.g. truncated by an interrupted writer), so the whole history is dropped and the
+            // file is started over, the shapes are recorded again by the inference requests
+            _records.clear();
+            _order.clear();
+            in.close();
+            std::ofstream(_filePath, std::ios::trunc);
+            return;
+        }
+        const auto inserted = _records.insert(std::move(shapes));
+        if (inserted.second)
+            _order.push_back(&*inserted.first);
+        shapes.clear();
+    }
+}
+
+std::vector<ShapesHistory::InputShapes> ShapesHistory::get(size_t limit) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<InputShapes> result;
+    for (auto it = _order.end() - std::min(limit, _order.size()); it != _order.end(); ++it)
+        result.push_back(**it);
+    return result;
+}
+
+void ShapesHistory::record(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_records.size() >= maxRecords)
+        return;
+    const auto inserted = _records.insert(shapes);
+    if (!inserted.second)
+        return;
+    _order.push_back(&*inserted.first);
+    if (_filePath.empty())
+        return;
+
+    // the record is formatted in advance to append it with a single write, so concurrent processes don't interleave
+    std::ostringstream record;
+    writeRecord(record, shapes);
+    std::ofstream out(_filePath, std::ios::app);
+    if (out.is_open())
+        out << record.str();
+}
+
+std::string ShapesHistory::computeModelId(const std::shared_ptr<const ov::Model>& model) {
+    size_t seed = 0;
+    hashCombine(seed, model->get_friendly_name());
+    for (const auto& op : model->get_ordered_ops()) {
+        std::ostringstream signature;
+        signature << op->get_type_info().name << op->get_type_info().get_version();
+        for (const auto& output : op->outputs())
+            signature << output.get_element_type() << output.get_partial_shape();
+        hashCombine(seed, signature.str());
+    }
+    for (const auto& param : model->get_parameters())
+        hashCombine(seed, param->get_friendly_name());
+
+    std::ostringstream id;
+    id << std::hex << seed;
+    return id.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
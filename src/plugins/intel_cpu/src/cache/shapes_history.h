@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "cpu_shape.h"
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Persistent history of the input shapes a dynamic model has been inferred with.
+ * The compiled primitives and JIT kernels can't be serialized, so instead the input shapes are stored in the cache
+ * directory and replayed when the same model is compiled again to pre-warm the runtime parameters cache before
+ * the first inference request.
+ * The history is append only, every new input shapes combination is written to the file as a single record.
+ */
+class ShapesHistory {
+public:
+    using Ptr = std::shared_ptr<ShapesHistory>;
+    using InputShapes = std::map<std::string, VectorDims>;
+
+    ShapesHistory(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model);
+
+    /**
+     * @brief Returns the input shapes recorded so far, including the ones loaded from the cache directory,
+     * in the order they were recorded.
+     * @param limit maximal number of the returned records, the most recent ones are returned
+     */
+    std::vector<InputShapes> get(size_t limit = maxRecords) const;
+
+    /**
+     * @brief Adds the input shapes to the history and appends them to the file if they haven't been seen before.
+     * @param shapes input dims mapped to the input names
+     */
+    void record(const InputShapes& shapes);
+
+    /**
+     * @brief Computes the model identifier used as the history file name. Only the topology and the shapes are taken
+     * into account, since the weights don't affect the primitives that are going to be created.
+     */
+    static std::string computeModelId(const std::shared_ptr<const ov::Model>& model);
+
+    // protects the history from growing infinitely for the models with data dependent shapes
+    static constexpr size_t maxRecords = 1024;
+
+private:
+    void load();
+
+    std::string _filePath;
+    mutable std::mutex _mutex;
+    std::set<InputShapes> _records;
+    // the records in the order they were added
+    std::vector<const InputShapes*> _order;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed between a number of independent LruCache shards by the key hash, and each shard is
+ * protected by its own mutex, so concurrent lookups of different keys rarely contend for the same lock.
+ * The LRU policy is applied within a shard.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t defaultShardsNum = 16;
+    // small caches are not split, so that the LRU policy is applied to all the records
+    static constexpr size_t minShardCapacity = 64;
+
+public:
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, capacity / minShardCapacity));
+        const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records. The records are evicted from the shards one by one.
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            if (0 == n)
+                break;
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            const size_t sizeBefore = shard->cache.size();
+            shard->cache.evict(n);
+            n -= sizeBefore - shard->cache.size();
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from all the shards since the cache creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const {
+        size_t evictions = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            evictions += shard->cache.getEvictionsCount();
+        }
+        return evictions;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+
+        std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        return *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
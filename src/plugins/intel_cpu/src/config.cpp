@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "cpu/cpu_config.hpp"
@@ -24,6 +25,45 @@ namespace intel_cpu {
 
 using namespace InferenceEngine;
 
+namespace {
+// "<input>:<d0>x<d1>...[,<input>:...][;<bucket>...]"
+std::vector<std::map<std::string, std::vector<size_t>>> parseShapeBuckets(const std::string& val) {
+    auto error = [&val]() {
+        IE_THROW() << "Wrong value " << val << " for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                   << ". Expected format is: input_name:1x32,other_input:1x32;input_name:1x64,other_input:1x64";
+    };
+
+    std::vector<std::map<std::string, std::vector<size_t>>> buckets;
+    std::stringstream bucketsStream(val);
+    std::string bucketStr;
+    while (std::getline(bucketsStream, bucketStr, ';')) {
+        if (bucketStr.empty())
+            continue;
+        std::map<std::string, std::vector<size_t>> bucket;
+        std::stringstream bucketStream(bucketStr);
+        std::string inputStr;
+        while (std::getline(bucketStream, inputStr, ',')) {
+            // the input name itself may contain colons, so the last one is the separator
+            const auto pos = inputStr.rfind(':');
+            if (pos == std::string::npos || pos == 0 || pos + 1 == inputStr.size())
+                error();
+            std::vector<size_t> dims;
+            std::stringstream dimsStream(inputStr.substr(pos + 1));
+            std::string dimStr;
+            while (std::getline(dimsStream, dimStr, 'x')) {
+                if (dimStr.empty() || dimStr.find_first_not_of("0123456789") != std::string::npos)
+                    error();
+                dims.push_back(std::stoul(dimStr));
+            }
+            if (!bucket.emplace(inputStr.substr(0, pos), dims).second)
+                error();
+        }
+        buckets.push_back(std::move(bucket));
+    }
+    return buckets;
+}
+}   // namespace
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -159,6 +199,40 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES) {
+                parallelBranches = true;
+            } else if (val == PluginConfigParams::NO) {
+                parallelBranches = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_NUMA_POLICY == key) {
+            if (val == "REPLICATE") {
+                numaPolicy = NumaPolicy::NP_Replicate;
+            } else if (val == "LOCAL") {
+                numaPolicy = NumaPolicy::NP_Local;
+            } else if (val == "SHARED") {
+                numaPolicy = NumaPolicy::NP_Shared;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_NUMA_POLICY
+                           << ". Expected only REPLICATE/LOCAL/SHARED";
+            }
+        } else if (CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT
+                           << ". Expected only non negative integer numbers";
+            }
+            warmUpShapesLimit = static_cast<size_t>(val_i);
+        } else if (CPUConfigParams::KEY_CPU_SHAPE_BUCKETS == key) {
+            shapeBuckets = parseShapeBuckets(val);
+            shapeBucketsStr = val;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -223,6 +297,24 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    if (parallelBranches) {
+        _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+    } else {
+        _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+    }
+    _config.insert({ CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, shapeBucketsStr });
+    _config.insert({ CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT, std::to_string(warmUpShapesLimit) });
+    switch (numaPolicy) {
+    case NumaPolicy::NP_Local:
+        _config.insert({ CPUConfigParams::KEY_CPU_NUMA_POLICY, "LOCAL" });
+        break;
+    case NumaPolicy::NP_Shared:
+        _config.insert({ CPUConfigParams::KEY_CPU_NUMA_POLICY, "SHARED" });
+        break;
+    default:
+        _config.insert({ CPUConfigParams::KEY_CPU_NUMA_POLICY, "REPLICATE" });
+        break;
+    }
 }
 
 #ifdef CPU_DEBUG_CAPS
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -28,6 +29,12 @@ struct Config {
         DO_On,
     };
 
+    enum NumaPolicy {
+        NP_Replicate,
+        NP_Local,
+        NP_Shared,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -50,6 +57,18 @@ struct Config {
 
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
+    // execute independent graph branches concurrently within a stream
+    bool parallelBranches = false;
+
+    NumaPolicy numaPolicy = NumaPolicy::NP_Replicate;
+
+    // number of the recorded input shapes replayed at compile time, 0 disables the shapes history
+    size_t warmUpShapesLimit = 16ul;
+
+    // input shapes the dynamic graph is precompiled for (see CPU_SHAPE_BUCKETS)
+    std::string shapeBucketsStr{};
+    std::vector<std::map<std::string, std::vector<size_t>>> shapeBuckets;
+
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
     std::map<std::string, std::string> _config;
@@ -197,6 +197,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Subgraph", Type::Subgraph},
         { "PriorBox", Type::PriorBox},
         { "PriorBoxClustered", Type::PriorBoxClustered},
+        { "GridSample", Type::GridSample},
+        { "RandomUniform", Type::RandomUniform},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -388,6 +390,10 @@ std::string NameFromType(const Type type) {
             return "Reference";
         case Type::Subgraph:
             return "Subgraph";
+        case Type::GridSample:
+            return "GridSample";
+        case Type::RandomUniform:
+            return "RandomUniform";
         default:
             return "Unknown";
     }
@@ -108,6 +108,8 @@ enum class Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
+    GridSample,
+    RandomUniform,
 };
 
 enum class Algorithm {
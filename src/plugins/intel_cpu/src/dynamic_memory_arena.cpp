@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_arena.h"
+
+#include <algorithm>
+#include <common/utils.hpp>
+#include "memory_solver.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t cacheLineSize = 64;
+}   // namespace
+
+void* ArenaMemoryMngr::getRawPtr() const noexcept {
+    return _inSlot ? _slot : _data.get();
+}
+
+void ArenaMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    _inSlot = true;
+    _slot = ptr;
+    _slotSize = size;
+    _data.reset();
+    _dataSize = 0;
+}
+
+bool ArenaMemoryMngr::resize(size_t size) {
+    _requestedSize = std::max(_requestedSize, size);
+    if (_inSlot ? size <= _slotSize : size <= _dataSize)
+        return false;
+
+    void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    _inSlot = false;
+    _dataSize = size;
+    _data.reset(ptr);
+    return true;
+}
+
+bool ArenaMemoryMngr::hasExtBuffer() const noexcept {
+    // the slot is owned by the arena, so the memory is still under the control of the graph
+    return false;
+}
+
+void ArenaMemoryMngr::destroy(void *ptr) {
+    dnnl::impl::free(ptr);
+}
+
+DnnlMemoryMngrPtr DynamicMemoryArena::addGroup(int start, int finish) {
+    auto mngr = new ArenaMemoryMngr();
+    auto dnnlMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(mngr));
+    _groups.push_back({mngr, dnnlMngr, start, finish});
+    return dnnlMngr;
+}
+
+bool DynamicMemoryArena::update() {
+    if (std::all_of(_groups.begin(), _groups.end(), [](const Group& group) {
+            return group.mngr->isInSlot() || group.mngr->getRequestedSize() == 0;
+        }))
+        return false;
+
+    std::vector<MemorySolver::Box> boxes;
+    boxes.reserve(_groups.size());
+    for (size_t i = 0; i < _groups.size(); i++) {
+        const auto& group = _groups[i];
+        const int64_t size = static_cast<int64_t>((group.mngr->getRequestedSize() + cacheLineSize - 1) / cacheLineSize);
+        boxes.push_back({group.start, group.finish, size, static_cast<int64_t>(i)});
+    }
+
+    MemorySolver solver(boxes);
+    const size_t arenaSize = static_cast<size_t>(solver.solve()) * cacheLineSize;
+
+    decltype(_arena) arena(dnnl::impl::malloc(arenaSize, cacheLineSize), destroy);
+    if (!arena) {
+        throw std::bad_alloc();
+    }
+
+    auto arenaPtr = static_cast<uint8_t*>(arena.get());
+    for (const auto& box : boxes) {
+        // notifies the registered memory objects about the new data location
+        _groups[box.id].dnnlMngr->setExtBuff(arenaPtr + solver.getOffset(box.id) * cacheLineSize,
+                                             static_cast<size_t>(box.size) * cacheLineSize);
+    }
+
+    _arena = std::move(arena);
+    _arenaSize = arenaSize;
+    return true;
+}
+
+void DynamicMemoryArena::destroy(void *ptr) {
+    dnnl::impl::free(ptr);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
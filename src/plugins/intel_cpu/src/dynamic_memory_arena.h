@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief A memory manager that places the data into the slot provided via setExtBuff() while the requested size
+ * fits into the slot, and falls back to an individual allocation otherwise. The largest requested size is tracked,
+ * so the arena could provide a sufficient slot next time.
+ */
+class ArenaMemoryMngr : public IMemoryMngr {
+public:
+    ArenaMemoryMngr() : _data(nullptr, destroy) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    size_t getRequestedSize() const noexcept {
+        return _requestedSize;
+    }
+    bool isInSlot() const noexcept {
+        return _inSlot;
+    }
+
+private:
+    bool _inSlot = false;
+    void* _slot = nullptr;
+    size_t _slotSize = 0ul;
+    size_t _requestedSize = 0ul;
+    size_t _dataSize = 0ul;
+    std::unique_ptr<void, void (*)(void *)> _data;
+
+    static void destroy(void *ptr);
+};
+
+/**
+ * @brief Single memory buffer shared by the groups of dynamic edges.
+ * The sizes of dynamic edges are known only during the inference, so the groups grow individually while the graph is
+ * executed. When some group outgrows its slot, the arena layout is recomputed by the MemorySolver for the largest
+ * sizes requested so far. Since the sizes only grow, the layout converges after a few shapes and the steady state
+ * inference doesn't allocate memory, while the groups with disjoint live time share the same memory.
+ */
+class DynamicMemoryArena {
+public:
+    DynamicMemoryArena() : _arena(nullptr, destroy) {}
+
+    /**
+     * @brief Creates a memory manager for a group of edges with the given live time
+     * @param start execution index of the first use of the group memory
+     * @param finish execution index of the last use of the group memory
+     */
+    DnnlMemoryMngrPtr addGroup(int start, int finish);
+
+    /**
+     * @brief Rebuilds the arena layout if some group has left its slot during the last inference.
+     * Must not be called while the groups memory holds data, which is still needed.
+     * @return true if the groups memory has been moved
+     */
+    bool update();
+
+    size_t getSize() const noexcept {
+        return _arenaSize;
+    }
+
+private:
+    struct Group {
+        ArenaMemoryMngr* mngr;
+        DnnlMemoryMngrPtr dnnlMngr;
+        int start;
+        int finish;
+    };
+
+    std::vector<Group> _groups;
+    size_t _arenaSize = 0ul;
+    std::unique_ptr<void, void (*)(void *)> _arena;
+
+    static void destroy(void *ptr);
+};
+
+using DynamicMemoryArenaPtr = std::shared_ptr<DynamicMemoryArena>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -404,6 +404,120 @@ private:
     int32_t value;
 };
 
+///
+/// \brief    Reduce accumulates the input into the output register, which is reserved by AssignRegisters for the whole snippet.
+/// The accumulator is initialized by ScalarEmitter before the vector tile and reduced by HorizonReduceEmitter
+/// before the scalar tile, so the full vector width can be used in both tiles: only the first lane matters in the scalar one.
+///
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto reduce = ov::as_type_ptr<ngraph::snippets::op::Reduce>(n);
+        if (!reduce)
+            IE_THROW() << "ReduceEmitter invoked with invalid op argument";
+        kind = reduce->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src0 = Vmm(in[0]);
+        Vmm vmm_acc  = Vmm(out[0]);
+
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src0);
+        else
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_src0);
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+class HorizonReduceEmitter : public jit_emitter {
+public:
+    HorizonReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto horizon = ov::as_type_ptr<ngraph::snippets::op::HorizonReduce>(n);
+        if (!horizon)
+            IE_THROW() << "HorizonReduceEmitter invoked with invalid op argument";
+        kind = horizon->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        Xmm xmm_acc = Xmm(out[0]);
+        Xmm xmm_aux = Xmm(aux_vec_idxs[0]);
+        auto reduce = [&](const Xmm& acc, const Xmm& x) {
+            if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+                h->uni_vmaxps(acc, acc, x);
+            else
+                h->uni_vaddps(acc, acc, x);
+        };
+
+        if (isa == dnnl::impl::cpu::x64::avx512_core) {
+            h->vextractf64x4(Ymm(xmm_aux.getIdx()), Zmm(in[0]), 1);
+            reduce(Ymm(out[0]), Ymm(xmm_aux.getIdx()));
+        }
+        if (isa != dnnl::impl::cpu::x64::sse41) {
+            h->vextractf128(xmm_aux, Ymm(out[0]), 1);
+            reduce(xmm_acc, xmm_aux);
+        }
+        h->uni_vmovshdup(xmm_aux, xmm_acc);           // acc:1,2,3,4; aux:2,2,4,4
+        reduce(xmm_acc, xmm_aux);                     // acc:1+2,2+2,3+4,4+4
+        h->uni_vmovhlps(xmm_aux, xmm_aux, xmm_acc);   // aux:3+4,4+4,4,4
+        reduce(xmm_acc, xmm_aux);                     // acc:1+2+3+4,...
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
 ///
 /// Memory emitters:
 ///
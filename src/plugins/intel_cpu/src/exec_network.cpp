@@ -26,6 +26,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -64,11 +65,13 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         bool loadedFromCache) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
+    _loadedFromCache(loadedFromCache),
     _network(network) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
@@ -99,6 +102,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        // the requests are served in FIFO order until some of them get the scheduling hints
+        streamsExecutorConfig._prioritized = true;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -117,6 +122,11 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
+    if (!_cfg.cache_dir.empty() && _cfg.warmUpShapesLimit > 0 && function->is_dynamic()) {
+        _shapesHistory = std::make_shared<ShapesHistory>(_cfg.cache_dir, function);
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -160,6 +170,79 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+
+    if (!_cfg.shapeBuckets.empty()) {
+        PrecompileShapeBuckets();
+    }
+    if (_shapesHistory) {
+        WarmUp();
+    }
+}
+
+void ExecNetwork::PrecompileShapeBuckets() {
+    const auto& inputNodes = GetGraph()._graph.GetInputNodesMap();
+    for (const auto& bucket : _cfg.shapeBuckets) {
+        for (const auto& input : bucket) {
+            const auto inputNode = inputNodes.find(input.first);
+            if (inputNode == inputNodes.end())
+                IE_THROW() << "Shape bucket refers to an unknown input: " << input.first;
+            const auto inputShape = inputNode->second->getOutputShapeAtPort(0).toPartialShape();
+            const ov::PartialShape bucketShape{ov::Shape{input.second}};
+            if (!inputShape.compatible(bucketShape))
+                IE_THROW() << "Shape bucket " << bucketShape << " for the input " << input.first
+                           << " is not compatible with the input shape " << inputShape;
+        }
+        for (const auto& input : inputNodes) {
+            if (input.second->isDynamicNode() && bucket.find(input.first) == bucket.end())
+                IE_THROW() << "Shape bucket doesn't specify the shape of the dynamic input: " << input.first;
+        }
+    }
+
+    // each stream graph has its own memory, so all of them are inferred on the buckets to allocate the memory
+    // for the largest one; the primitives are created only once, since the runtime cache is shared.
+    // The graphs are inferred on the threads of their streams, so the memory is placed on the NUMA node of the stream
+    std::mutex warmedUpMutex;
+    std::unordered_set<const Graph*> warmedUpGraphs;
+    auto warmUpStreamGraph = [&] {
+        auto graphLock = GetGraph();
+        auto& graph = graphLock._graph;
+        {
+            std::lock_guard<std::mutex> lock{warmedUpMutex};
+            if (!warmedUpGraphs.insert(&graph).second)
+                return;
+        }
+        if (!graph.IsReady())
+            IE_THROW() << "Can't precompile the shape buckets: the stream graph is not ready";
+        if (!graph.hasDynamicInput())
+            return;
+        for (const auto& bucket : _cfg.shapeBuckets) {
+            graph.WarmUp(bucket);
+        }
+    };
+
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        // the same task may be taken by a stream twice, so the tasks are resubmitted until each graph is warmed up
+        std::vector<Task> tasks(_graphs.size(), warmUpStreamGraph);
+        do {
+            _taskExecutor->runAndWait(tasks);
+        } while (warmedUpGraphs.size() < _graphs.size());
+    } else {
+        warmUpStreamGraph();
+    }
+}
+
+void ExecNetwork::WarmUp() {
+    // the runtime parameters cache is shared between the streams, so it's enough to warm up a single graph
+    auto graphLock = GetGraph();
+    if (!graphLock._graph.hasDynamicInput())
+        return;
+    for (const auto& inputShapes : _shapesHistory->get(_cfg.warmUpShapesLimit)) {
+        try {
+            graphLock._graph.WarmUp(inputShapes);
+        } catch (...) {
+            // the history may contain the shapes the model can't be inferred with, they are just skipped
+        }
+    }
 }
 
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
@@ -179,7 +262,11 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                // the weights of the first NUMA node are used by the streams of all the nodes
+                const int weightsNumaNodeId = _cfg.numaPolicy == Config::NumaPolicy::NP_Shared ?
+                                              getAvailableNUMANodes().front() : numaNodeId;
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[weightsNumaNodeId], _rtParamsCache);
+                graphLock._graph.setStreamsExecutor(std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_taskExecutor));
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -310,6 +397,10 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::zero_copy_ports.name()),
+            RO_property(ov::intel_cpu::queueing_statistics.name()),
+            RO_property(ov::loaded_from_cache.name()),
         };
     }
 
@@ -352,6 +443,52 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        const auto stats = _rtParamsCache->getStatistics();
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"hits", stats.hits},
+            {"misses", stats.misses},
+            {"evictions", stats.evictions},
+        };
+    } else if (name == ov::intel_cpu::zero_copy_ports) {
+        // the same conditions the infer request checks before binding the user memory to the graph
+        auto isPlain = [](const MemoryDesc& desc, InferenceEngine::Precision prc) {
+            return desc.getPrecision() == prc && desc.hasLayoutType(LayoutType::ncsp);
+        };
+        auto& mutableGraph = graphLock._graph;
+        decltype(ov::intel_cpu::zero_copy_ports)::value_type zeroCopyPorts;
+        const auto inputsInfo = _network.getInputsInfo();
+        for (const auto& input : mutableGraph.GetInputNodesMap()) {
+            const auto info = inputsInfo.find(input.first);
+            zeroCopyPorts["input:" + input.first] = info != inputsInfo.end() && !config.batchLimit &&
+                                         !mutableGraph.hasMeanImageFor(input.first) &&
+                                         isPlain(input.second->getChildEdgeAt(0)->getMemory().getDesc(), info->second->getPrecision()) &&
+                                         mutableGraph.canUseExternalInputMemory(input.second);
+        }
+        const auto outputsInfo = _network.getOutputsInfo();
+        for (const auto& output : mutableGraph.GetOutputNodesMap()) {
+            const auto info = outputsInfo.find(output.first);
+            zeroCopyPorts["output:" + output.first] = info != outputsInfo.end() && !config.batchLimit &&
+                                          isPlain(output.second->getParentEdgeAt(0)->getMemory().getDesc(), info->second->getPrecision()) &&
+                                          mutableGraph.canUseExternalOutputMemory(output.second);
+        }
+        return zeroCopyPorts;
+    } else if (name == ov::intel_cpu::queueing_statistics) {
+        decltype(ov::intel_cpu::queueing_statistics)::value_type queueingStatistics;
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor);
+        if (streamsExecutor) {
+            for (const auto& priorityClass : streamsExecutor->GetQueueStatistics()) {
+                const auto prefix = ov::util::to_string(priorityClass.first) + ":";
+                const auto& stats = priorityClass.second;
+                queueingStatistics[prefix + "tasks"] = stats._tasks;
+                queueingStatistics[prefix + "total_delay_us"] = stats._totalDelay.count();
+                queueingStatistics[prefix + "max_delay_us"] = stats._maxDelay.count();
+                queueingStatistics[prefix + "missed_deadlines"] = stats._missedDeadlines;
+            }
+        }
+        return queueingStatistics;
+    } else if (name == ov::loaded_from_cache) {
+        return decltype(ov::loaded_from_cache)::value_type(_loadedFromCache);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -9,6 +9,7 @@
 
 #include "graph.h"
 #include "extension_mngr.h"
+#include "cache/shapes_history.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -36,7 +37,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                bool loadedFromCache = false);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -57,6 +59,7 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    const bool                                  _loadedFromCache;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -68,6 +71,10 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                           _numaNodesWeights;
+    // runtime parameters cache shared between the graphs of all the streams
+    MultiCachePtr                               _rtParamsCache;
+    // input shapes of the dynamic model persisted in the cache directory
+    ShapesHistory::Ptr                          _shapesHistory;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -80,6 +87,9 @@ protected:
 
     bool isLegacyAPI() const;
 
+    void PrecompileShapeBuckets();
+    void WarmUp();
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
@@ -25,6 +25,7 @@
 #include "nodes/input.h"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
+#include "nodes/concat.h"
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -68,7 +69,7 @@ Graph::~Graph() {
 
 template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
-        WeightsSharing::Ptr &w_cache) {
+        WeightsSharing::Ptr &w_cache, const MultiCachePtr& sharedRtCache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
 
     if (IsReady())
@@ -76,7 +77,9 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    // the graph works with its own view of the runtime cache shared between the streams
+    rtParamsCache = sharedRtCache ? std::make_shared<MultiCache>(sharedRtCache)
+                                  : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -119,9 +122,9 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 }
 
 template void Graph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const MultiCachePtr&);
 template void Graph::CreateGraph(const CNNNetwork&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const MultiCachePtr&);
 
 void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const ExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -396,6 +399,8 @@ void Graph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    parallelBranches = CanExecuteBranchesInParallel();
+
     Allocate();
 
     CreatePrimitives();
@@ -473,6 +478,28 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (!parallelBranches)
+        return;
+
+    std::map<int, std::vector<NodePtr>> waves;
+    size_t maxWaveWidth = 0;
+    for (const auto& node : executableGraphNodes) {
+        auto& wave = waves[nodeWaves[node->execIndex]];
+        wave.push_back(node);
+        maxWaveWidth = std::max(maxWaveWidth, wave.size());
+    }
+
+    // there is nothing to execute concurrently, so fallback to the sequential execution
+    if (maxWaveWidth < 2)
+        return;
+
+    for (auto& wave : waves)
+        executableWaves.emplace_back(std::move(wave.second));
+
+    // dnnl stream is not supposed to be used from several threads simultaneously
+    for (size_t i = 0; i < maxWaveWidth; i++)
+        branchStreams.emplace_back(eng);
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -658,9 +685,78 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
     return edge_clusters;
 }
 
+bool Graph::CanExecuteBranchesInParallel() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return false;
+
+    // The memory of the dynamic nodes is reallocated on the fly and the states are implicitly ordered by
+    // the sequential execution, so such graphs are always executed node by node.
+    return std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    });
+#else
+    return false;
+#endif
+}
+
+void Graph::ScheduleParallelBranches() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ScheduleParallelBranches");
+
+    edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
+    std::unordered_map<EdgePtr, size_t> edge_cluster_indices;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        for (auto& edge : edge_clusters[i])
+            edge_cluster_indices[edge] = i;
+    }
+
+    // A node is placed to the wave following the waves of all its producers. If the node may overwrite its input
+    // in place, it must also follow all the nodes reading the same memory before it in the sequential order.
+    nodeWaves.assign(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int wave = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (!parent->isConstant())
+                wave = std::max(wave, nodeWaves[parent->execIndex] + 1);
+        }
+
+        if (auto selectedPD = node->getSelectedPrimitiveDescriptor()) {
+            for (const auto& outConf : selectedPD->getConfig().outConfs) {
+                const int inPlacePort = outConf.inPlace();
+                if (inPlacePort < 0 || static_cast<size_t>(inPlacePort) >= node->getParentEdges().size())
+                    continue;
+
+                for (const auto& inEdge : node->getParentEdgesAtPort(inPlacePort)) {
+                    auto cluster_it = edge_cluster_indices.find(inEdge);
+                    if (cluster_it == edge_cluster_indices.end())
+                        continue;
+
+                    for (const auto& edge : edge_clusters[cluster_it->second]) {
+                        auto consumer = edge->getChild();
+                        if (consumer != node && consumer->execIndex < node->execIndex)
+                            wave = std::max(wave, nodeWaves[consumer->execIndex] + 1);
+                    }
+                }
+            }
+        }
+
+        nodeWaves[node->execIndex] = wave;
+    }
+}
+
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    // The nodes of one wave are executed simultaneously in parallel branches mode,
+    // so the wave index becomes the timestamp of the memory live time.
+    auto timestamp = [this](const NodePtr& node) {
+        return nodeWaves.empty() ? node->execIndex : nodeWaves[node->execIndex];
+    };
+
     size_t edge_clusters_count = edge_clusters.size();
 
     for (size_t i = 0; i < edge_clusters_count;) {
@@ -693,12 +789,13 @@ void Graph::AllocateWithReuse() {
 
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
+    std::vector<MemorySolver::Box> undefinedIOBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = timestamp(edge->getParent());
+            int e_finish = timestamp(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -736,7 +833,10 @@ void Graph::AllocateWithReuse() {
             definedBoxes.push_back(box);
         } else {
             box.size = boxSize;
-            undefinedBoxes.push_back(box);
+            if (isInput | isOutput)
+                undefinedIOBoxes.push_back(box);
+            else
+                undefinedBoxes.push_back(box);
         }
     }
 
@@ -772,13 +872,15 @@ void Graph::AllocateWithReuse() {
         IE_ASSERT(count == 1);
     }
 
-    if (!undefinedBoxes.empty()) {
-        MemorySolver::normalizeBoxes(undefinedBoxes);
-
-        std::vector<std::vector<MemorySolver::Box>> groups; //groups of nonoverlapping boxes
-        groups.push_back({undefinedBoxes.front()});
-        for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
-            const auto& box = undefinedBoxes[i];
+    // groups of nonoverlapping boxes
+    auto groupBoxes = [](std::vector<MemorySolver::Box>& boxes) {
+        std::vector<std::vector<MemorySolver::Box>> groups;
+        if (boxes.empty())
+            return groups;
+        MemorySolver::normalizeBoxes(boxes);
+        groups.push_back({boxes.front()});
+        for (size_t i = 1; i < boxes.size(); ++i) {
+            const auto& box = boxes[i];
             bool groupFound = false;
             for (auto& group : groups) {
                 const auto& lastBox = group.back();
@@ -793,16 +895,37 @@ void Graph::AllocateWithReuse() {
                 groups.push_back({box});
             }
         }
+        return groups;
+    };
+
+    auto allocateGroup = [&](const std::vector<MemorySolver::Box>& group, const DnnlMemoryMngrPtr& grpMemMngr) {
+        for (auto& box : group) {
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    edge->allocate(grpMemMngr);
+                }
+            }
+        }
+    };
+
+    // The input and output data must outlive the inference, so their memory is allocated individually.
+    for (auto& group : groupBoxes(undefinedIOBoxes)) {
+        allocateGroup(group,
+                      std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())));
+    }
+
+    // The intermediate dynamic data is placed into the arena, which layout is planned by the MemorySolver
+    // as soon as the actual sizes are known.
+    auto groups = groupBoxes(undefinedBoxes);
+    if (!groups.empty()) {
+        dynamicMemArena = std::make_shared<DynamicMemoryArena>();
         for (auto& group : groups) {
-            auto grpMemMngr =
-                std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+            int start = std::numeric_limits<int>::max(), finish = 0;
             for (auto& box : group) {
-                for (auto& edge : edge_clusters[box.id]) {
-                    if (edge->getStatus() == Edge::Status::NeedAllocation) {
-                        edge->allocate(grpMemMngr);
-                    }
-                }
+                start = std::min(start, box.start);
+                finish = std::max(finish, box.finish);
             }
+            allocateGroup(group, dynamicMemArena->addGroup(start, finish));
         }
     }
 }
@@ -815,9 +938,17 @@ void Graph::Allocate() {
     //   NotAllocated - view on other blob, peer or in-place
     for (auto& edge : graphEdges) edge->init();
 
+    // Define the execution waves before the memory planning, since they affect the edges live time
+    if (parallelBranches)
+        ScheduleParallelBranches();
+
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
+    // The graph is created by the stream it belongs to, so the first touch places the memory pages on its NUMA node
+    if (config.numaPolicy == Config::NumaPolicy::NP_Local)
+        memWorkspace->FillZero();
+
     // Resolve all other edges with status NotAllocated and in-place
     for (auto& node : graphNodes) node->resolveInPlaceEdges();
 
@@ -834,6 +965,75 @@ void Graph::CreatePrimitives() {
     }
 }
 
+bool Graph::canUseExternalInputMemory(const NodePtr& input) const {
+    // Input cannot be in-place with other primitives
+    for (auto& childEdge : input->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << input->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant())
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<node::Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Type::Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool Graph::canUseExternalOutputMemory(const NodePtr& output) const {
+    // the dynamic output memory is reallocated during the inference
+    if (output->isDynamicNode())
+        return false;
+
+    auto parentEdge = output->getParentEdgeAt(0);
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+        // the output passed through from the input would rebind the input memory as well
+        if (parent->getType() == Type::Input)
+            return false;
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
@@ -946,6 +1146,7 @@ void Graph::PullOutputData(BlobMap &out) {
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
         if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
+            // The strided and padded user blobs are never bound to the graph memory, the reorder writes them instead.
             // User can initialize output via SetOutput API using tensorDesc with ANY layout.
             // For these cases we create planar memory descriptor.
             auto outBlobDesc = expectedDesc.getLayout() == InferenceEngine::Layout::ANY
@@ -1001,20 +1202,84 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    dnnl::stream stream(eng);
+    if (!executableWaves.empty()) {
+        InferParallelBranches(request);
+    } else {
+        dnnl::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
+    }
+
+    // The intermediate data is not needed anymore, so the dynamic memory can be moved to the updated arena layout.
+    if (dynamicMemArena && dynamicMemArena->update()) {
+        // prepareParams() is expected to be called after the memory reallocation
+        for (auto& node : executableGraphNodes) {
+            if (node->isDynamicNode())
+                node->lastInputDims.clear();
+        }
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::WarmUp(const std::map<std::string, VectorDims>& inputShapes) {
+    // the warm up inference would corrupt the memory states
+    if (std::any_of(graphNodes.begin(), graphNodes.end(),
+                    [](const NodePtr& node) { return node->getType() == Type::MemoryInput; }))
+        return;
+
+    for (auto& input : inputNodesMap) {
+        auto& node = input.second;
+        if (node->isDynamicNode()) {
+            const auto shape = inputShapes.find(input.first);
+            if (shape == inputShapes.end())
+                IE_THROW() << "Warm up shape is not specified for the dynamic input: " << input.first;
+            node->redefineOutputMemory({shape->second});
+        }
+        if (!node->getChildEdges().empty())
+            node->getChildEdgeAt(0)->getMemoryPtr()->FillZero();
+    }
+
+    Infer();
+}
+
+void Graph::InferParallelBranches(InferRequestBase* request) {
+    const int streamThreads = parallel_get_max_threads();
+
+    for (const auto& wave : executableWaves) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (wave.size() == 1 || !streamsExecutor) {
+            for (const auto& node : wave) {
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+                ExecuteNode(node, branchStreams.front());
+            }
+            continue;
+        }
+
+        // the stream threads are evenly divided between the branches of the wave
+        std::vector<InferenceEngine::Task> branches;
+        for (size_t i = 0; i < wave.size(); i++) {
+            branches.emplace_back([&, i] {
+                const auto& node = wave[i];
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+                ExecuteNode(node, branchStreams[i]);
+            });
+        }
+        streamsExecutor->ExecuteNested(branches, std::max(1, streamThreads / static_cast<int>(wave.size())));
+    }
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
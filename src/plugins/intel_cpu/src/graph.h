@@ -7,10 +7,13 @@
 #include "cpp/ie_cnn_network.h"
 #include "config.h"
 #include "cpu_memory.h"
+#include "dynamic_memory_arena.h"
 #include "normalize_preprocess.h"
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "ie_parallel.hpp"
+#include "threading/ie_istreams_executor.hpp"
 #include <map>
 #include <string>
 #include <vector>
@@ -50,10 +53,16 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    // the executor of the stream the graph belongs to, it runs the independent branches in the nested arenas
+    void setStreamsExecutor(const InferenceEngine::IStreamsExecutor::Ptr& executor) {
+        streamsExecutor = executor;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
-                     WeightsSharing::Ptr &w_cache);
+                     WeightsSharing::Ptr &w_cache,
+                     const MultiCachePtr& sharedRtCache = nullptr);
 
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
@@ -65,10 +74,32 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Copies the outputs to the user blobs unless a blob shares the memory with the graph output.
+     * Only the user blobs with the dense descriptor equal to the graph output one are bound to the graph memory
+     * (see canUseExternalOutputMemory). The strided, padded or differently laid out blobs are always filled with a
+     * reorder: the producer primitives are created for the dense memory, so they can't write to such blobs directly.
+     */
     void PullOutputData(InferenceEngine::BlobMap &out);
 
+    /**
+     * @brief Checks whether the graph topology allows to replace the memory of the input (output) node with the user
+     * provided one, so that the data is not copied to (from) the graph memory.
+     * The user memory descriptor must be compatible with the node memory descriptor as well.
+     * The TensorIterator uses the same checks to bind the body ports to the slices of the outer tensors.
+     */
+    bool canUseExternalInputMemory(const NodePtr& input) const;
+    bool canUseExternalOutputMemory(const NodePtr& output) const;
+
     void Infer(InferRequestBase* request = nullptr);
 
+    /**
+     * @brief Infers the graph on zero filled inputs of the given shapes, so that all the shape dependent primitives
+     * are created and put to the runtime parameters cache in advance. The output data is discarded.
+     * @param inputShapes input dims mapped to the input names
+     */
+    void WarmUp(const std::map<std::string, VectorDims>& inputShapes);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -208,6 +239,13 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+
+        parallelBranches = false;
+        streamsExecutor.reset();
+        nodeWaves.clear();
+        executableWaves.clear();
+        branchStreams.clear();
+        dynamicMemArena.reset();
     }
     Status status { NotReady };
     Config config;
@@ -219,6 +257,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    // memory of the intermediate dynamic edges
+    DynamicMemoryArenaPtr dynamicMemArena;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -245,6 +285,10 @@ protected:
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
 
+    bool CanExecuteBranchesInParallel() const;
+    void ScheduleParallelBranches();
+    void InferParallelBranches(InferRequestBase* request);
+
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
     friend class intel_cpu::InferRequestBase;
@@ -263,6 +307,16 @@ private:
 
     MultiCachePtr rtParamsCache;
 
+    // Parallel branches execution mode (see CPU_PARALLEL_BRANCHES).
+    // The executable nodes are grouped into waves of mutually independent nodes. The waves are executed one by one,
+    // while the nodes of a wave are executed concurrently, each one in its own arena with a share of the stream threads.
+    bool parallelBranches = false;
+    std::vector<int> nodeWaves;     // wave index for each node, indexed by the node exec index
+    std::vector<std::vector<NodePtr>> executableWaves;
+    std::vector<dnnl::stream> branchStreams;
+    // runs the branches in the nested arenas bound to the cores of the stream
+    InferenceEngine::IStreamsExecutor::Ptr streamsExecutor;
+
     void EnforceBF16();
 };
 
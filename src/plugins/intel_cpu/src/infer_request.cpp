@@ -8,7 +8,6 @@
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
-#include "nodes/concat.h"
 #include "nodes/split.h"
 #include <ie_compound_blob.h>
 #include <ie_common.h>
@@ -149,6 +148,21 @@ void InferRequestBase::redefineMemoryForInputNodes() {
     }
 }
 
+void InferRequestBase::recordInputShapes() {
+    // the history is shared by all the requests, so it's only updated when the shapes of this request change
+    bool changed = lastInputShapes.size() != _inputs.size();
+    for (const auto& input : _inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        auto& lastDims = lastInputShapes[input.first];
+        if (lastDims != dims) {
+            lastDims = dims;
+            changed = true;
+        }
+    }
+    if (changed)
+        execNetwork->_shapesHistory->record(lastInputShapes);
+}
+
 void InferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
@@ -160,6 +174,9 @@ void InferRequestBase::InferImpl() {
 
     if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
+        if (execNetwork->_shapesHistory) {
+            recordInputShapes();
+        }
     } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
         const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
         SetBatch(batch);
@@ -208,57 +225,8 @@ void InferRequestBase::changeDefaultPtr() {
             NodePtr inputNodePtr = input->second;
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
                 continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Type::Concatenation) {
-                    auto concat = dynamic_cast<node::Concat*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Type::Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
+            if (graph->canUseExternalInputMemory(inputNodePtr)) {
+                for (auto& edge : inputNodePtr->getChildEdges()) {
                     auto e = edge.lock();
                     if (!e)
                         IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
@@ -277,31 +245,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            NodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (graph->canUseExternalOutputMemory(output->second))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -736,7 +680,8 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
+        if (!isDynamic && blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
+                desc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -782,8 +727,8 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 _inputs[name] = make_blob_with_precision(desc);
                 _inputs[name]->allocate();
 
-                if (!isDynamic &&
-                    desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
+                const auto& memDesc = graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc();
+                if (!isDynamic && memDesc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(desc)) &&
                         graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                     externalPtr[name] = _inputs[name]->buffer();
                 }
@@ -839,8 +784,9 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 }
 
                 _outputs[name] = data;
+                const auto& memDesc = output->second->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
                 if (!isDynamic && !externalPtr.count(name) &&
-                    data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(output->second->getParentEdgesAtPort(0)[0]->getMemory().getDesc()) &&
+                    memDesc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(data->getTensorDesc())) &&
                         !graph->getProperty().batchLimit) {
                     externalPtr[name] = data->buffer();
                 }
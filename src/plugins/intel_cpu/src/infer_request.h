@@ -5,6 +5,7 @@
 #pragma once
 
 #include "graph.h"
+#include "cache/shapes_history.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -62,12 +63,15 @@ private:
     void PushStates();
     void PullStates();
     void redefineMemoryForInputNodes();
+    void recordInputShapes();
 
     void changeDefaultPtr();
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    // the input shapes of the previous inference, recorded to the shapes history
+    ShapesHistory::InputShapes          lastInputShapes;
 };
 
 class LegacyInferRequest : public InferRequestBase {
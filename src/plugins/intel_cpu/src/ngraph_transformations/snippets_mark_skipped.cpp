@@ -151,6 +151,14 @@ int getChannelAxis(const ov::AxisSet &axes, bool keep_dims) {
     return channelAxis;
 }
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node, int &channelAxis) {
+    // Innermost-axis reduction is tokenized together with its elementwise producers instead: this saves a pass over
+    // the full-size input, while the fused post-ops would only be applied to the reduced output
+    if (snippets::pass::IsInnermostAxisReduction(node)) {
+        const auto producer = node->get_input_node_shared_ptr(0);
+        if (snippets::pass::GetSnippetsNodeType(producer) != snippets::pass::SnippetsNodeType::SkippedByPlugin &&
+            snippets::pass::AppropriateForSubgraph(producer))
+            return false;
+    }
     const bool is_suitable_node = ov::is_type<ngraph::op::v0::MVN>(node) ||
                                   ov::is_type<ngraph::op::v6::MVN>(node) ||
                                   ov::is_type<ngraph::op::v0::NormalizeL2>(node) ||
@@ -0,0 +1,47 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "score_filter.h"
+
+#include <functional>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// every element is stored unconditionally and the output position advances only for the passed ones
+template <typename Pass, typename Store>
+size_t filterScoresImpl(const float* scores, size_t count, float threshold, Pass pass, Store store) {
+    size_t selected = 0;
+    for (size_t i = 0; i < count; i++) {
+        store(selected, scores[i], static_cast<int>(i));
+        selected += static_cast<size_t>(pass(scores[i], threshold));
+    }
+    return selected;
+}
+
+template <typename Store>
+size_t filterScoresImpl(const float* scores, size_t count, float threshold, bool inclusive, Store store) {
+    if (inclusive)
+        return filterScoresImpl(scores, count, threshold, std::greater_equal<float>(), store);
+    return filterScoresImpl(scores, count, threshold, std::greater<float>(), store);
+}
+
+}   // namespace
+
+size_t filterScores(const float* scores, size_t count, float threshold, bool inclusive, int* indices) {
+    return filterScoresImpl(scores, count, threshold, inclusive, [indices](size_t pos, float, int idx) {
+        indices[pos] = idx;
+    });
+}
+
+size_t filterScores(const float* scores, size_t count, float threshold, bool inclusive, std::pair<float, int>* candidates) {
+    return filterScoresImpl(scores, count, threshold, inclusive, [candidates](size_t pos, float score, int idx) {
+        candidates[pos] = std::make_pair(score, idx);
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,97 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Candidates prefiltering shared by the NMS family nodes (NonMaxSuppression, MatrixNms, MulticlassNms,
+ * DetectionOutput): the scores thresholding and the top-k ordering, which dominate the post-processing of
+ * the detectors with tens of thousands of anchors.
+ */
+
+/**
+ * @brief Writes the indices of the scores passing the threshold to the indices buffer.
+ * It is a plain scalar loop: every index is stored, and the output position advances by the comparison result
+ * instead of branching on it, so the compiler is free to emit it without the jumps on the random scores.
+ * @param scores
+ * the scores to filter
+ * @param count
+ * number of the scores
+ * @param threshold
+ * the score threshold
+ * @param inclusive
+ * whether the scores equal to the threshold pass the filter
+ * @param indices
+ * output buffer, must have room for count elements
+ * @return number of the selected indices.
+ */
+size_t filterScores(const float* scores, size_t count, float threshold, bool inclusive, int* indices);
+
+/**
+ * @brief The same as above, but writes the {score, index} pairs.
+ */
+size_t filterScores(const float* scores, size_t count, float threshold, bool inclusive, std::pair<float, int>* candidates);
+
+/**
+ * @brief Orders the k first (by comp) elements of [first, last) and moves them to the front, the rest elements
+ * are left unordered. The selection is linear, so unlike std::partial_sort (O(n log k)) and the full sort it
+ * doesn't depend much on the candidates count.
+ */
+template <typename RandomIt, typename Compare>
+void sortTopK(RandomIt first, RandomIt last, size_t k, Compare comp) {
+    if (k < static_cast<size_t>(std::distance(first, last))) {
+        std::nth_element(first, first + k, last, comp);
+        last = first + k;
+    }
+    std::sort(first, last, comp);
+}
+
+/**
+ * @brief Gives access to the candidates in comp order, sorting them by chunks on demand.
+ * NMS usually selects its output boxes long before all the candidates are visited, so the most of them never
+ * need to be sorted.
+ */
+template <typename T, typename Compare>
+class LazySortedCandidates {
+public:
+    LazySortedCandidates(std::vector<T>& candidates, size_t firstChunk, Compare comp)
+            : m_candidates(candidates), m_chunk(std::max(firstChunk, static_cast<size_t>(1))), m_comp(comp) {}
+
+    const T& operator[](size_t idx) {
+        while (idx >= m_sortedCount) {
+            sortTopK(m_candidates.begin() + m_sortedCount, m_candidates.end(), m_chunk, m_comp);
+            m_sortedCount = std::min(m_sortedCount + m_chunk, m_candidates.size());
+            // the long tails are sorted by the growing chunks
+            m_chunk *= 2;
+        }
+        return m_candidates[idx];
+    }
+
+    size_t size() const {
+        return m_candidates.size();
+    }
+
+private:
+    std::vector<T>& m_candidates;
+    size_t m_sortedCount = 0;
+    size_t m_chunk;
+    Compare m_comp;
+};
+
+template <typename T, typename Compare>
+LazySortedCandidates<T, Compare> makeLazySortedCandidates(std::vector<T>& candidates, size_t firstChunk, Compare comp) {
+    return LazySortedCandidates<T, Compare>(candidates, firstChunk, comp);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
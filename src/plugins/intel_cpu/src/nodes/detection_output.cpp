@@ -10,6 +10,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "detection_output.h"
+#include "common/score_filter.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -393,13 +394,7 @@ inline void DetectionOutput::confFilterCF(float* reorderedConfData, int* indices
         int *pindices = indicesData + off;
         int *pbuffer = indicesBufData + off;
 
-        int count = 0;
-        for (int i = 0; i < numPriorsActual[n]; ++i) {
-            if (pconf[i] > confidenceThreshold) {
-                pindices[count] = i;
-                count++;
-            }
-        }
+        int count = static_cast<int>(filterScores(pconf, numPriorsActual[n], confidenceThreshold, false, pindices));
 
         // in:  pindices count
         // out: buffer detectionCount
@@ -719,10 +714,10 @@ inline void DetectionOutput::decodeBBoxes(const float *priorData,
     });
 }
 
+// indicesOut must have room for n elements, its k first ones are the result
 inline void DetectionOutput::topk(const int *indicesIn, int *indicesOut, const float *conf, int n, int k) {
-    std::partial_sort_copy(indicesIn, indicesIn + n,
-                           indicesOut, indicesOut + k,
-                           ConfidenceComparatorDO(conf));
+    std::copy(indicesIn, indicesIn + n, indicesOut);
+    sortTopK(indicesOut, indicesOut + n, k, ConfidenceComparatorDO(conf));
 }
 
 static inline float JaccardOverlap(const float *decodedBbox,
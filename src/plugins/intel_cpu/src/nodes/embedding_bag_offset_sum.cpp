@@ -47,11 +47,9 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
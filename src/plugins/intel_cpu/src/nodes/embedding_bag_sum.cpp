@@ -5,11 +5,15 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <type_traits>
+#include <immintrin.h>
 #include <dnnl_types.h>
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
 
 using namespace InferenceEngine;
 
@@ -46,14 +50,74 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+namespace {
+
+// The rows gathered from the large tables miss the caches, so the rows of the upcoming indices are prefetched
+// to overlap the memory latency with the accumulation.
+constexpr size_t prefetchDistance = 8lu;
+constexpr size_t cacheLineSize = 64lu;
+
+inline void prefetchRow(const void* row, size_t rowBytes) {
+    const auto* rowPtr = reinterpret_cast<const char*>(row);
+    for (size_t offset = 0lu; offset < rowBytes; offset += cacheLineSize) {
+        _mm_prefetch(rowPtr + offset, _MM_HINT_T0);
+    }
+}
+
+// The bf16 and the 8-bit tables are accumulated in fp32, which vectorizes well after widening the rows.
+// The fp32 and the i32 tables are accumulated in their own type as the reference does.
+template<typename T>
+struct AccumulatorType {
+    using type = T;
+};
+
+template<>
+struct AccumulatorType<bfloat16_t> {
+    using type = float;
+};
+
+template<>
+struct AccumulatorType<int8_t> {
+    using type = float;
+};
+
+template<>
+struct AccumulatorType<uint8_t> {
+    using type = float;
+};
+
+// The 8-bit sums are exact in fp32 while they stay below 2^24, and they wrap around to the table type
+// the same way as the accumulation in the table type does, so the results match the reference.
+template<typename T, typename std::enable_if<std::is_integral<T>::value, bool>::type = true>
+inline T fromAccumulator(float value) {
+    return static_cast<T>(static_cast<int64_t>(value));
+}
+
+template<typename T, typename std::enable_if<!std::is_integral<T>::value, bool>::type = true>
+inline T fromAccumulator(float value) {
+    return static_cast<T>(value);
+}
+
+}   // namespace
+
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dstData,
                                   const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    using AccT = typename AccumulatorType<T>::type;
+    constexpr bool accumulateInDst = std::is_same<T, AccT>::value;
+
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
     initFromInputs();
 
     const size_t outputBagsNum = outDataDims[0];
+    const size_t tableRowsNum = inDataDims[0];
+    const size_t rowBytes = _embDepth * sizeof(T);
+
+    auto prefetchIndex = [&](int index) {
+        if (static_cast<size_t>(index) < tableRowsNum)
+            prefetchRow(srcData + index * _embDepth, rowBytes);
+    };
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
@@ -65,51 +129,60 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dst
         const int* indices = nullptr;
         int weightsIdx = 0lu;
         bool withWeights = _withWeights;
+        std::vector<AccT> accBuffer(accumulateInDst ? 0lu : _embDepth);
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
+            T* dst = dstData + obi * _embDepth;
             getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+            if (indices == nullptr) {
+                std::fill(dst, dst + _embDepth, static_cast<T>(0));
+                continue;
+            }
+            withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            AccT* acc = accumulateInDst ? reinterpret_cast<AccT*>(dst) : accBuffer.data();
+            for (size_t inIdx = 0lu; inIdx < std::min(prefetchDistance, indicesSize); inIdx++) {
+                prefetchIndex(indices[inIdx]);
+            }
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (inIdx + prefetchDistance < indicesSize)
+                    prefetchIndex(indices[inIdx + prefetchDistance]);
+
+                if (static_cast<size_t>(indices[inIdx]) >= tableRowsNum) {
+                    IE_THROW() << msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                 }
-                size_t srcIndex = indices[inIdx] * _embDepth;
+                const T* src = srcData + indices[inIdx] * _embDepth;
 
                 if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                    const AccT weight = static_cast<AccT>(weightsData[weightsIdx]);
+                    if (inIdx == 0lu) {
+                        for (size_t i = 0lu; i < _embDepth; i++) {
+                            acc[i] = static_cast<AccT>(src[i]) * weight;
+                        }
+                    } else {
+                        for (size_t i = 0lu; i < _embDepth; i++) {
+                            acc[i] += static_cast<AccT>(src[i]) * weight;
+                        }
                     }
                     weightsIdx++;
                 } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
+                    if (inIdx == 0lu) {
                         for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
+                            acc[i] = static_cast<AccT>(src[i]);
                         }
-                        weightsIdx++;
                     } else {
                         for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
+                            acc[i] += static_cast<AccT>(src[i]);
                         }
                     }
                 }
-            } else {
+            }
+
+            if (!accumulateInDst) {
                 for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] = fromAccumulator<T>(acc[i]);
                 }
             }
         }
@@ -125,6 +198,10 @@ void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
         }
+        case Precision::BF16: {
+            return processData<bfloat16_t>(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const bfloat16_t*>(weightsData), reinterpret_cast<bfloat16_t*>(dstData), inDims, outDims);
+        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), inDims, outDims);
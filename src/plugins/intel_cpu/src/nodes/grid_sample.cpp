@@ -0,0 +1,330 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "grid_sample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <utils/bfloat16.hpp>
+#include <utils/general_utils.h>
+
+using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+
+using InterpolationMode = ov::op::v9::GridSample::InterpolationMode;
+using PaddingMode = ov::op::v9::GridSample::PaddingMode;
+
+// the output pixels are processed by the chunks: the interpolation taps of the chunk are computed once and then
+// reused for all the channels
+constexpr size_t pixelsChunk = 64lu;
+// the denormalized coordinates are clamped to keep the indices arithmetic in the int range
+constexpr float maxCoordinate = static_cast<float>(1 << 24);
+
+// https://github.com/onnx/onnx/blob/a92870cdf359297495a118184dca2eaecee4b717/onnx/backend/test/case/node/resize.py#L201-L207
+inline void cubicCoeffs(const float r, float* coeffs) {
+    constexpr float A = -0.75f;
+    coeffs[0] = ((A * (r + 1) - 5 * A) * (r + 1) + 8 * A) * (r + 1) - 4 * A;
+    coeffs[1] = ((A + 2) * r - (A + 3)) * r * r + 1;
+    coeffs[2] = ((A + 2) * (1 - r) - (A + 3)) * (1 - r) * (1 - r) + 1;
+    coeffs[3] = ((A * (2 - r) - 5 * A) * (2 - r) + 8 * A) * (2 - r) - 4 * A;
+}
+
+// the nearest index, the halves are rounded to the even (as the reference does) regardless of the current rounding mode
+inline float roundHalfToEven(const float value) {
+    if (std::abs(value - std::trunc(value)) == 0.5f)
+        return 2.f * std::round(value / 2.f);
+    return std::round(value);
+}
+
+}   // namespace
+
+bool GridSample::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto gridSample = ov::as_type_ptr<const ov::op::v9::GridSample>(op);
+        if (!gridSample) {
+            errorMessage = "Only opset9 GridSample operation is supported";
+            return false;
+        }
+        if (!op->get_input_element_type(DATA_INDEX).is_real()) {
+            errorMessage = "Only floating point 'data' input is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+GridSample::GridSample(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache) :
+        Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "GridSample layer with name '" + getName() + "'";
+    if (inputShapes.size() != 2 || outputShapes.size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+    if (getInputShapeAtPort(DATA_INDEX).getRank() != 4 || getInputShapeAtPort(GRID_INDEX).getRank() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D 'data' and 'grid' inputs";
+
+    attrs = ov::as_type_ptr<const ov::op::v9::GridSample>(op)->get_attributes();
+}
+
+void GridSample::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision dataPrecision = getOriginalInputPrecisionAtPort(DATA_INDEX);
+    if (dataPrecision != Precision::BF16 || !mayiuse(avx512_core))
+        dataPrecision = Precision::FP32;
+
+    // the channels are the innermost loop of the execution, so the channels last and the blocked layouts are
+    // processed with the contiguous vectorized accesses
+    std::vector<LayoutType> dataFormats{LayoutType::ncsp};
+    const auto& channels = getInputShapeAtPort(DATA_INDEX).getDims()[1];
+    if (channels != Shape::UNDEFINED_DIM && channels != 1) {
+        dataFormats.push_back(LayoutType::nspc);
+        dataFormats.push_back(mayiuse(avx512_core) ? LayoutType::nCsp16c : LayoutType::nCsp8c);
+    }
+    for (const auto& format : dataFormats) {
+        addSupportedPrimDesc({{format, dataPrecision}, {LayoutType::ncsp, Precision::FP32}},
+                             {{format, dataPrecision}},
+                             impl_desc_type::ref);
+    }
+}
+
+GridSample::DataLayout GridSample::getDataLayout(const MemoryPtr& memPtr) {
+    const auto& desc = memPtr->getDesc();
+    const auto blockedDesc = memPtr->GetDescWithType<BlockedMemoryDesc>();
+    const auto& strides = blockedDesc->getStrides();
+    const auto& dims = memPtr->getStaticDims();
+
+    DataLayout layout;
+    layout.batchStride = strides[0];
+    if (desc.hasLayoutType(LayoutType::nspc)) {
+        layout.blockSize = dims[1];
+        layout.blocksCount = 1;
+        layout.blockStride = 0;
+        layout.spatialStride = dims[1];
+    } else if (desc.hasLayoutType(LayoutType::nCsp8c) || desc.hasLayoutType(LayoutType::nCsp16c)) {
+        const auto& blockDims = blockedDesc->getBlockDims();
+        layout.blockSize = blockDims.back();
+        layout.blocksCount = blockDims[1];
+        layout.blockStride = strides[1];
+        layout.spatialStride = layout.blockSize;
+    } else {
+        layout.blockSize = 1;
+        layout.blocksCount = dims[1];
+        layout.blockStride = strides[1];
+        layout.spatialStride = 1;
+    }
+    return layout;
+}
+
+void GridSample::prepareParams() {
+    const auto& dataMemPtr = getParentEdgeAt(DATA_INDEX)->getMemoryPtr();
+    const auto& gridMemPtr = getParentEdgeAt(GRID_INDEX)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    if (!dataMemPtr || !dataMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has not allocated input memory of 'data'";
+    if (!gridMemPtr || !gridMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has not allocated input memory of 'grid'";
+    if (!dstMemPtr || !dstMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has not allocated output memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    execPtr = std::make_shared<GridSampleExecutor>(attrs,
+                                                   dataMemPtr->getStaticDims(), getDataLayout(dataMemPtr),
+                                                   gridMemPtr->getStaticDims(), getDataLayout(dstMemPtr));
+}
+
+void GridSample::executeDynamicImpl(dnnl::stream strm) {
+    execute(std::move(strm));
+}
+
+void GridSample::execute(dnnl::stream strm) {
+    if (!execPtr)
+        IE_THROW() << errorPrefix << " has no compiled executor";
+
+    const auto& dataMem = getParentEdgeAt(DATA_INDEX)->getMemory();
+    const auto* grid = reinterpret_cast<const float*>(getParentEdgeAt(GRID_INDEX)->getMemoryPtr()->GetPtr());
+    auto* dst = getChildEdgeAt(0)->getMemoryPtr()->GetPtr();
+
+    const auto dataPrecision = dataMem.getDesc().getPrecision();
+    switch (dataPrecision) {
+        case Precision::FP32:
+            execPtr->exec(reinterpret_cast<const float*>(dataMem.GetPtr()), grid, reinterpret_cast<float*>(dst));
+            break;
+        case Precision::BF16:
+            execPtr->exec(reinterpret_cast<const bfloat16_t*>(dataMem.GetPtr()), grid, reinterpret_cast<bfloat16_t*>(dst));
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported 'data' input precision: " << dataPrecision.name();
+    }
+}
+
+bool GridSample::created() const {
+    return getType() == Type::GridSample;
+}
+
+GridSample::GridSampleExecutor::GridSampleExecutor(const ov::op::v9::GridSample::Attributes& attributes,
+                                                   const VectorDims& dataDims, const DataLayout& srcDataLayout,
+                                                   const VectorDims& gridDims, const DataLayout& dstDataLayout)
+        : attrs{attributes}
+        , batch{dataDims[0]}
+        , srcH{dataDims[2]}
+        , srcW{dataDims[3]}
+        , dstSpatial{gridDims[1] * gridDims[2]}
+        , axisTaps{attributes.mode == InterpolationMode::NEAREST ? 1lu :
+                   attributes.mode == InterpolationMode::BILINEAR ? 2lu : 4lu}
+        , taps{axisTaps * axisTaps}
+        , srcLayout{srcDataLayout}
+        , dstLayout{dstDataLayout} {
+    if (gridDims[0] != batch || gridDims[3] != 2)
+        IE_THROW() << "'grid' input shape is inconsistent with the 'data' input shape";
+    if (srcLayout.blockSize != dstLayout.blockSize || srcLayout.blocksCount != dstLayout.blocksCount)
+        IE_THROW() << "Input/output tensors layouts mismatch";
+}
+
+int GridSample::GridSampleExecutor::padIndex(int index, size_t length, bool& valid) const {
+    const auto size = static_cast<int>(length);
+    valid = true;
+    switch (attrs.padding_mode) {
+        case PaddingMode::ZEROS:
+            valid = index >= 0 && index < size;
+            return valid ? index : 0;
+        case PaddingMode::BORDER:
+            return std::min(std::max(index, 0), size - 1);
+        case PaddingMode::REFLECTION:
+        default:
+            if (attrs.align_corners) {
+                if (size == 1)
+                    return 0;
+                const auto period = 2 * (size - 1);
+                index = std::abs(index) % period;
+                return index >= size ? period - index : index;
+            } else {
+                const auto period = 2 * size;
+                index = (index % period + period) % period;
+                return index >= size ? period - 1 - index : index;
+            }
+    }
+}
+
+void GridSample::GridSampleExecutor::computeAxisTaps(float coordinate, size_t length, int* indices, float* weights) const {
+    const auto range = static_cast<float>(length);
+    float denormalized = attrs.align_corners ? (coordinate + 1) * (range - 1) / 2
+                                             : ((coordinate + 1) * range - 1) / 2;
+    denormalized = std::min(std::max(denormalized, -maxCoordinate), maxCoordinate);
+
+    int first = 0;
+    switch (attrs.mode) {
+        case InterpolationMode::NEAREST:
+            first = static_cast<int>(roundHalfToEven(denormalized));
+            weights[0] = 1.f;
+            break;
+        case InterpolationMode::BILINEAR: {
+            const auto topLeft = std::floor(denormalized);
+            const auto delta = denormalized - topLeft;
+            first = static_cast<int>(topLeft);
+            weights[0] = 1.f - delta;
+            weights[1] = delta;
+            break;
+        }
+        case InterpolationMode::BICUBIC:
+        default: {
+            const auto topLeft = std::floor(denormalized);
+            first = static_cast<int>(topLeft) - 1;
+            cubicCoeffs(denormalized - topLeft, weights);
+            break;
+        }
+    }
+    for (size_t i = 0; i < axisTaps; ++i) {
+        bool valid = true;
+        indices[i] = padIndex(first + static_cast<int>(i), length, valid);
+        if (!valid)
+            weights[i] = 0.f;
+    }
+}
+
+void GridSample::GridSampleExecutor::computeTaps(const float* grid, size_t count, int* offsets, float* weights) const {
+    int xIndices[4], yIndices[4];
+    float xWeights[4], yWeights[4];
+    for (size_t p = 0; p < count; ++p) {
+        computeAxisTaps(grid[2 * p], srcW, xIndices, xWeights);
+        computeAxisTaps(grid[2 * p + 1], srcH, yIndices, yWeights);
+        for (size_t j = 0; j < axisTaps; ++j) {
+            for (size_t i = 0; i < axisTaps; ++i) {
+                offsets[j * axisTaps + i] = yIndices[j] * static_cast<int>(srcW) + xIndices[i];
+                weights[j * axisTaps + i] = yWeights[j] * xWeights[i];
+            }
+        }
+        offsets += taps;
+        weights += taps;
+    }
+}
+
+template<typename T>
+void GridSample::GridSampleExecutor::exec(const T* src, const float* grid, T* dst) const {
+    const size_t chunks = div_up(dstSpatial, pixelsChunk);
+    const size_t blockSize = srcLayout.blockSize;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0lu, end = 0lu;
+        splitter(batch * chunks, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<int> offsets(pixelsChunk * taps);
+        std::vector<float> weights(pixelsChunk * taps);
+        std::vector<float> accumulator(blockSize);
+        for (size_t item = start; item < end; ++item) {
+            const size_t n = item / chunks;
+            const size_t firstPixel = (item % chunks) * pixelsChunk;
+            const size_t count = std::min(pixelsChunk, dstSpatial - firstPixel);
+            computeTaps(grid + (n * dstSpatial + firstPixel) * 2, count, offsets.data(), weights.data());
+
+            for (size_t cb = 0; cb < srcLayout.blocksCount; ++cb) {
+                const T* srcBlock = src + n * srcLayout.batchStride + cb * srcLayout.blockStride;
+                T* dstBlock = dst + n * dstLayout.batchStride + cb * dstLayout.blockStride;
+                for (size_t p = 0; p < count; ++p) {
+                    const int* pixelOffsets = &offsets[p * taps];
+                    const float* pixelWeights = &weights[p * taps];
+                    float* acc = accumulator.data();
+                    std::fill(acc, acc + blockSize, 0.f);
+                    for (size_t k = 0; k < taps; ++k) {
+                        const float weight = pixelWeights[k];
+                        if (weight == 0.f)
+                            continue;
+                        const T* srcPixel = srcBlock + pixelOffsets[k] * srcLayout.spatialStride;
+                        for (size_t ci = 0; ci < blockSize; ++ci) {
+                            acc[ci] += weight * static_cast<float>(srcPixel[ci]);
+                        }
+                    }
+                    T* dstPixel = dstBlock + (firstPixel + p) * dstLayout.spatialStride;
+                    for (size_t ci = 0; ci < blockSize; ++ci) {
+                        dstPixel[ci] = static_cast<T>(acc[ci]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,83 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <openvino/op/grid_sample.hpp>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class GridSample : public Node {
+public:
+    GridSample(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // The data element offset is: n * batchStride + cb * blockStride + (y * W + x) * spatialStride + ci,
+    // where cb is the channels block and ci is the channel inside the block. So the planar layout has the blocks of
+    // a single channel, the channels last layout has a single block of all the channels.
+    struct DataLayout {
+        size_t batchStride = 0lu;
+        size_t blockStride = 0lu;
+        size_t spatialStride = 0lu;
+        size_t blockSize = 0lu;
+        size_t blocksCount = 0lu;
+    };
+
+    struct GridSampleExecutor {
+        GridSampleExecutor(const ov::op::v9::GridSample::Attributes& attributes,
+                           const VectorDims& dataDims, const DataLayout& srcDataLayout,
+                           const VectorDims& gridDims, const DataLayout& dstDataLayout);
+
+        template<typename T>
+        void exec(const T* src, const float* grid, T* dst) const;
+
+    private:
+        // the source pixels used for the output pixel: the spatial offsets and the interpolation weights
+        // (the padded pixels have zero weights)
+        void computeTaps(const float* grid, size_t count, int* offsets, float* weights) const;
+        void computeAxisTaps(float coordinate, size_t length, int* indices, float* weights) const;
+        int padIndex(int index, size_t length, bool& valid) const;
+
+        const ov::op::v9::GridSample::Attributes attrs;
+        const size_t batch;
+        const size_t srcH;
+        const size_t srcW;
+        const size_t dstSpatial;
+        const size_t axisTaps;
+        const size_t taps;
+        const DataLayout srcLayout;
+        const DataLayout dstLayout;
+    };
+
+    using ExecutorPtr = std::shared_ptr<GridSampleExecutor>;
+    ExecutorPtr execPtr = nullptr;
+
+    static DataLayout getDataLayout(const MemoryPtr& memPtr);
+
+    ov::op::v9::GridSample::Attributes attrs;
+    std::string errorPrefix;
+
+    static constexpr size_t DATA_INDEX = 0lu;
+    static constexpr size_t GRID_INDEX = 1lu;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
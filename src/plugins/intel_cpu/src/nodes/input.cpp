@@ -15,6 +15,7 @@
 #include <ie_parallel.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <blob_factory.hpp>
+#include <ie_system_conf.h>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
@@ -350,13 +351,26 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    auto isCloneRequired = [&] () {
+        return !isBlobAligned() || hasSubnormals() || isWA();
+    };
+
+    auto wrapBlob = [&, this] () {
+        MemoryPtr ptr = MemoryPtr(new Memory(getEngine()));
+        ptr->Create(memDesc, constOp->get_data_ptr());
+        return ptr;
+    };
+
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        // The copy is made to place the weights to the local memory of the NUMA node. With a single NUMA node
+        // the constant data (e.g. memory mapped from the weights file) is shared as is.
+        const bool singleNumaNode = InferenceEngine::getAvailableNUMANodes().size() < 2;
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), [&] () {
+            return singleNumaNode && !isCloneRequired() ? wrapBlob() : cloneBlob();
+        });
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
-        auto ptr = new Memory(getEngine());
-        ptr->Create(memDesc, constOp->get_data_ptr());
-        memoryPtr = MemoryCPtr(ptr);
+    } else if (!isCloneRequired()) {
+        memoryPtr = std::const_pointer_cast<const Memory>(wrapBlob());
     } else {
         memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
     }
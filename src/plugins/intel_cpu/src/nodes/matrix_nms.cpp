@@ -13,6 +13,7 @@
 #include "ie_parallel.hpp"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
+#include "common/score_filter.h"
 
 using namespace InferenceEngine;
 
@@ -169,10 +170,7 @@ static inline float intersectionOverUnion(const float* bbox1, const float* bbox2
 
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
     std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+    const auto end = candidateIndex.begin() + filterScores(scoresData, m_numBoxes, m_scoreThreshold, false, candidateIndex.data());
     int64_t numDet = 0;
     int64_t originalSize = std::distance(candidateIndex.begin(), end);
     if (originalSize <= 0) {
@@ -182,8 +180,8 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
         originalSize = m_nmsTopk;
     }
 
-    std::partial_sort(candidateIndex.begin(), candidateIndex.begin() + originalSize, end, [&scoresData](int32_t a, int32_t b) {
-        return scoresData[a] > scoresData[b];
+    sortTopK(candidateIndex.begin(), end, originalSize, [&scoresData](int32_t a, int32_t b) {
+        return scoresData[a] > scoresData[b] || (scoresData[a] == scoresData[b] && a < b);
     });
 
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
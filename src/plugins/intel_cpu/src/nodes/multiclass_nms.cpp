@@ -17,6 +17,7 @@
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/score_filter.h"
 
 using namespace InferenceEngine;
 
@@ -545,16 +546,16 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // align with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            std::vector<std::pair<float, int>> sorted_boxes(cur_numBoxes);
+            // the threshold is inclusive to align with ref
+            sorted_boxes.resize(filterScores(scoresPtr, cur_numBoxes, m_scoreThreshold, true, sorted_boxes.data()));
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                // only the nms_top_k best candidates take part in the suppression
+                sortTopK(sorted_boxes.begin(), sorted_boxes.end(), m_nmsRealTopk,
+                         [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
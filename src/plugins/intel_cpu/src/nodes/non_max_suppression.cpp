@@ -14,6 +14,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
+#include "common/score_filter.h"
 
 #include "cpu/x64/jit_generator.hpp"
 #include "emitters/jit_load_store_emitters.hpp"
@@ -995,19 +996,17 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
-            if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+        std::vector<std::pair<float, int>> candidates(numBoxes);  // score, box_idx
+        candidates.resize(filterScores(scoresPtr, numBoxes, scoreThreshold, false, candidates.data()));
+        // the selection usually ends long before all the candidates are visited, so they are sorted on demand
+        auto sorted_boxes = makeLazySortedCandidates(candidates, 2 * maxOutputBoxesPerClass,
+                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                          });
 
         int io_selection_size = 0;
         size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
             filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
@@ -0,0 +1,215 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "random_uniform.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <openvino/core/type/bfloat16.hpp>
+#include <utils/general_utils.h>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+
+// Philox 4x32-10 constants, the same as in the reference implementation:
+// https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+constexpr uint32_t crushResistanceConstLow = 0x9E3779B9;
+constexpr uint32_t crushResistanceConstHigh = 0xBB67AE85;
+constexpr uint64_t statisticMaximizingMultiplierN = 0xD2511F53;
+constexpr uint64_t statisticMaximizingMultiplierCounter = 0xCD9E8D57;
+constexpr size_t roundsNumber = 10lu;
+// the sequence elements skipped between the runs (for parity with Tensorflow)
+constexpr uint64_t skipConst = 256lu;
+
+// each Philox invocation generates 4 values, the consecutive invocations differ only by the 'n' counter, so they
+// are computed independently by the lanes of the vectorized loops
+constexpr size_t philoxOutputSize = 4lu;
+constexpr size_t philoxLanes = 16lu;
+
+void runPhilox(uint64_t key, uint64_t counter, uint64_t n, uint32_t (&result)[philoxOutputSize][philoxLanes]) {
+    uint32_t nLow[philoxLanes], nHigh[philoxLanes], counterLow[philoxLanes], counterHigh[philoxLanes];
+    for (size_t lane = 0; lane < philoxLanes; ++lane) {
+        const uint64_t laneN = n + lane;
+        // the 'n' overflow is carried to the counter
+        const uint64_t laneCounter = laneN < n ? counter + 1 : counter;
+        nLow[lane] = static_cast<uint32_t>(laneN);
+        nHigh[lane] = static_cast<uint32_t>(laneN >> 32);
+        counterLow[lane] = static_cast<uint32_t>(laneCounter);
+        counterHigh[lane] = static_cast<uint32_t>(laneCounter >> 32);
+    }
+
+    uint32_t keyLow = static_cast<uint32_t>(key);
+    uint32_t keyHigh = static_cast<uint32_t>(key >> 32);
+    for (size_t round = 0; round < roundsNumber; ++round) {
+        for (size_t lane = 0; lane < philoxLanes; ++lane) {
+            const uint64_t productN = statisticMaximizingMultiplierN * nLow[lane];
+            const uint64_t productCounter = statisticMaximizingMultiplierCounter * counterLow[lane];
+            nLow[lane] = static_cast<uint32_t>(productCounter >> 32) ^ nHigh[lane] ^ keyLow;
+            nHigh[lane] = static_cast<uint32_t>(productCounter);
+            counterLow[lane] = static_cast<uint32_t>(productN >> 32) ^ counterHigh[lane] ^ keyHigh;
+            counterHigh[lane] = static_cast<uint32_t>(productN);
+        }
+        keyLow += crushResistanceConstLow;
+        keyHigh += crushResistanceConstHigh;
+    }
+
+    for (size_t lane = 0; lane < philoxLanes; ++lane) {
+        result[0][lane] = nLow[lane];
+        result[1][lane] = nHigh[lane];
+        result[2][lane] = counterLow[lane];
+        result[3][lane] = counterHigh[lane];
+    }
+}
+
+// The conversions set the mantissa bits of the value in [1, 2) and mirror the reference arithmetic exactly,
+// so the output is bit-identical with it.
+inline float toUniform(uint32_t x, float min, float max) {
+    const uint32_t bits = (static_cast<uint32_t>(127) << 23) | (x & 0x7fffffu);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return (value - 1.0f) * (max - min) + min;
+}
+
+inline ov::bfloat16 toUniform(uint32_t x, ov::bfloat16 min, ov::bfloat16 max) {
+    const auto bits = static_cast<uint16_t>((static_cast<uint16_t>(127) << 7) | (static_cast<uint16_t>(x) & 0x7fu));
+    return (ov::bfloat16::from_bits(bits) - static_cast<ov::bfloat16>(1)) * (max - min) + min;
+}
+
+// the range is computed in the unsigned arithmetic, so the full int32 range doesn't overflow; min < max is checked
+// by the caller, otherwise the range would be zero
+inline int32_t toUniform(uint32_t x, int32_t min, int32_t max) {
+    const auto range = static_cast<uint32_t>(static_cast<int64_t>(max) - min);
+    return static_cast<int32_t>(x % range + static_cast<uint32_t>(min));
+}
+
+}   // namespace
+
+bool RandomUniform::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto randomUniform = ov::as_type_ptr<const ngraph::op::v8::RandomUniform>(op);
+        if (!randomUniform) {
+            errorMessage = "Only opset8 RandomUniform operation is supported";
+            return false;
+        }
+        if (!one_of(randomUniform->get_out_type(), ngraph::element::f32, ngraph::element::bf16, ngraph::element::i32)) {
+            errorMessage = "Doesn't support output precision: " + randomUniform->get_out_type().get_type_name();
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+RandomUniform::RandomUniform(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache) :
+        Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "RandomUniform layer with name '" + getName() + "'";
+    if (inputShapes.size() != 3 || outputShapes.size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto randomUniform = ov::as_type_ptr<const ngraph::op::v8::RandomUniform>(op);
+    globalSeed = randomUniform->get_global_seed();
+    opSeed = randomUniform->get_op_seed();
+    state = randomUniform->get_state();
+
+    // RandomUniform generates the new sequence each run, so it is not folded even if all the inputs are constants
+    constant = ConstantType::NoConst;
+}
+
+void RandomUniform::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto outPrecision = getOriginalOutputPrecisionAtPort(0);
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::I32},
+                          {LayoutType::ncsp, outPrecision},
+                          {LayoutType::ncsp, outPrecision}},
+                         {{LayoutType::ncsp, outPrecision}},
+                         impl_desc_type::ref);
+}
+
+void RandomUniform::execute(dnnl::stream strm) {
+    const auto elementsCount = getChildEdgeAt(0)->getMemory().GetShape().getElementsCount();
+
+    // when both seeds are zero the sequence is non-deterministic, the same as in the reference implementation
+    uint64_t key = globalSeed;
+    if (globalSeed == 0 && opSeed == 0) {
+        std::srand(std::time(nullptr));
+        key = std::rand();
+    }
+    const uint64_t n = state.first;
+    const uint64_t counter = state.second > 0 ? state.second : opSeed;
+
+    const auto outPrecision = getChildEdgeAt(0)->getMemory().getDesc().getPrecision();
+    switch (outPrecision) {
+        case Precision::FP32:
+            executeSpecified<float>(key, counter, n, elementsCount);
+            break;
+        case Precision::BF16:
+            executeSpecified<ov::bfloat16>(key, counter, n, elementsCount);
+            break;
+        case Precision::I32:
+            executeSpecified<int32_t>(key, counter, n, elementsCount);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported output precision: " << outPrecision.name();
+    }
+
+    // the counters of the next run
+    const uint64_t skipCount = elementsCount * skipConst;
+    state.first += skipCount;
+    if (state.first < skipCount)
+        state.second++;
+}
+
+template <typename T>
+void RandomUniform::executeSpecified(uint64_t key, uint64_t counter, uint64_t n, size_t elementsCount) {
+    const T min = *reinterpret_cast<const T*>(getParentEdgeAt(MIN_INDEX)->getMemoryPtr()->GetPtr());
+    const T max = *reinterpret_cast<const T*>(getParentEdgeAt(MAX_INDEX)->getMemoryPtr()->GetPtr());
+    // the same check as in the operation validation, the min and max values may be known only at runtime
+    if (!(min < max))
+        IE_THROW() << errorPrefix << " expects the min value to be less than the max value, got min: "
+                   << static_cast<double>(min) << ", max: " << static_cast<double>(max);
+    auto* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    constexpr size_t blockElements = philoxOutputSize * philoxLanes;
+    const size_t blocksCount = div_up(elementsCount, blockElements);
+    parallel_for(blocksCount, [&](size_t block) {
+        // the Philox 'n' counter of the first element in the block, the overflow is carried to the counter
+        const uint64_t blockN = n + block * philoxLanes;
+        const uint64_t blockCounter = blockN < n ? counter + 1 : counter;
+        uint32_t random[philoxOutputSize][philoxLanes];
+        runPhilox(key, blockCounter, blockN, random);
+
+        const size_t firstElement = block * blockElements;
+        const size_t count = std::min(blockElements, elementsCount - firstElement);
+        T* blockDst = dst + firstElement;
+        for (size_t i = 0; i < count; ++i) {
+            blockDst[i] = toUniform(random[i % philoxOutputSize][i / philoxOutputSize], min, max);
+        }
+    });
+}
+
+bool RandomUniform::created() const {
+    return getType() == Type::RandomUniform;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
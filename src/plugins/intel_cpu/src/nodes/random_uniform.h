@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class RandomUniform : public Node {
+public:
+    RandomUniform(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    bool needPrepareParams() const override {return false;};
+    bool needShapeInfer() const override {return true;};
+    void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
+    std::vector<VectorDims> shapeInfer() const override {
+        return Node::shapeInferGeneric(PortMask(SHAPE_INDEX));
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template<typename T>
+    void executeSpecified(uint64_t key, uint64_t counter, uint64_t n, size_t elementsCount);
+
+    std::string errorPrefix;
+    uint64_t globalSeed = 0lu;
+    uint64_t opSeed = 0lu;
+    // the Philox counters of the next run: {n, counter}
+    std::pair<uint64_t, uint64_t> state{0lu, 0lu};
+
+    static constexpr size_t SHAPE_INDEX = 0lu;
+    static constexpr size_t MIN_INDEX = 1lu;
+    static constexpr size_t MAX_INDEX = 2lu;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -71,11 +71,13 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // Reduction is performed along the innermost logical axis, so it's supported only for the planar layout
+    const bool hasReduction = snippet->has_reduction();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReduction;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReduction;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -329,6 +331,10 @@ void Snippet::define_schedule() {
 
     auto find_dims_to_collapse = [this, config]() -> int {
         int collapsedDims = 0;
+        // A reduction snippet produces one output value per innermost row, so neither the rows can be collapsed
+        // nor the outer tile can be used: every kernel call processes exactly one row
+        if (snippet->has_reduction())
+            return collapsedDims;
         size_t minimalConcurrency = parallel_get_max_threads();
         size_t minimalJitWorkAmount = 256;
         size_t currentJitWorkAmount = exec_domain.back();
@@ -4,7 +4,9 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <dnnl_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
@@ -77,6 +79,18 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// The chunks are dense in the plain outer tensor if all its dims before the iteration axis are 1.
+static bool canBindSlices(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule) {
+    const auto &full_desc = full->getDesc();
+    const auto &part_desc = part->getDesc();
+    if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+        full_desc.getPrecision() != part_desc.getPrecision())
+        return false;
+
+    const auto &full_dims = full->getStaticDims();
+    return std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; });
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -144,6 +158,43 @@ private:
     int iter_count;
 };
 
+/**
+ * Rebinds the body port memory to the current chunk of the outer tensor, so the body reads the sliced input or writes
+ * the concatenated output in place, without the copies. Applicable only when the chunks are dense in the outer tensor.
+ */
+class PortSliceBindHelper : public PortMapHelper {
+public:
+    PortSliceBindHelper(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule)
+                        : full_mem(full), part_mem_mngr(part->getDnnlMemoryMngr()) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        const auto sign_of_stride = slice_rule.stride < 0 ? -1 : 1;
+
+        iter_count = full->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        chunk_size_in_byte = part->GetSize();
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_size_in_byte : 0;
+        chunk_stride_in_byte = sign_of_stride * static_cast<ptrdiff_t>(chunk_size_in_byte);
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        // the memory manager is shared by all the body edges of the port, so they are rebound together
+        part_mem_mngr->setExtBuff(static_cast<uint8_t *>(full_mem->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter,
+                                  chunk_size_in_byte);
+    }
+
+private:
+    size_t chunk_size_in_byte = 0;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_mem;
+    DnnlMemoryMngrPtr part_mem_mngr;
+
+    int iter_count;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -228,28 +279,33 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
     elem_size = DnnlExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
+void DynamicBuffer::reserve(const int iter_count) {
+    expected_iter_count = iter_count;
+}
+
 void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
     if (iter == 0) {
         init(eng);
-        return;
+    } else {
+        if (from->getStaticDims()[map_rule.axis] != static_cast<size_t>(std::abs(map_rule.stride)))
+            IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " <<
+                       std::abs(map_rule.stride) << " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
+        if (num_execs == capacity) {
+            const auto new_capacity = capacity * 2;
+            move_buffer(create_buffer(eng, new_capacity), new_capacity);
+        }
     }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
     move_data();
 }
 
 void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
     const auto axis = map_rule.axis;
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
 
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
-    auto dims = src_desc.dims();
+    auto dims = from->GetPrimitive().get_desc().dims();
 
     if (dims[axis] != abs_stride)
         IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
@@ -257,60 +313,51 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
 
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, 1, std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
-
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
-
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
+    chunk_len = abs_stride * len;
 
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    num_execs = 0;
+    capacity = expected_iter_count > 0 ? static_cast<size_t>(expected_iter_count) : 1lu;
+    mem_holder_buffer = create_buffer(eng, capacity);
+}
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    }
+std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng, const size_t new_capacity) {
+    auto dims = from->GetPrimitive().get_desc().dims();
+    dims[map_rule.axis] = new_capacity * std::abs(map_rule.stride);
+    dnnl::memory::desc new_buffer_desc(dims, from->GetDataType(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
 
     return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer, const size_t new_capacity) {
+    // the stored chunks keep their place relative to the buffer start (or to the end for the negative stride)
+    const auto dst_offset = map_rule.stride > 0 ? 0lu : (new_capacity - num_execs) * chunk_len;
+    copy(get_ptr(*mem_holder_buffer.get()) + data_offset_in_byte(), get_ptr(*new_buffer.get()) + dst_offset,
+         capacity * chunk_len, new_capacity * chunk_len, count, num_execs * chunk_len);
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
     mem_holder_buffer = new_buffer;
+    capacity = new_capacity;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    const auto chunk_idx = map_rule.stride > 0 ? num_execs : capacity - 1 - num_execs;
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_idx * chunk_len,
+         chunk_len, capacity * chunk_len, count, chunk_len);
+    num_execs++;
+}
 
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+size_t DynamicBuffer::data_offset_in_byte() const {
+    return map_rule.stride > 0 ? 0lu : (capacity - num_execs) * chunk_len;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
     if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+        auto dims = DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims());
+        dims[map_rule.axis] = num_execs * std::abs(map_rule.stride);
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        copy(get_ptr(*mem_holder_buffer.get()) + data_offset_in_byte(), reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             capacity * chunk_len, num_execs * chunk_len, count, num_execs * chunk_len);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -370,6 +417,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -379,8 +427,9 @@ void TensorIterator::getSupportedDescriptors() {
         const auto inputID = ngraph::op::util::create_ie_output_name(prev);
         auto outNode = outMap.find(inputID);
         if (outNode != outMap.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            output_mem.push_back(outMem);
+            auto outEdge = outNode->second->getParentEdgeAt(0);
+            output_mem.push_back(outEdge->getMemoryPtr());
+            output_edges.push_back(outEdge);
         }
     }
 
@@ -490,7 +539,9 @@ void TensorIterator::prepareParams() {
     prepareInitialCond();
 
     first_mappers.clear();
+    last_mappers.clear();
     before_mappers.clear();
+    after_mappers.clear();
     back_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
@@ -501,8 +552,9 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // the back edges read the previous iteration outputs before the outputs are rebound to the next chunks
             prepareBackEdges();
+            prepareOutputPorts();
         }
     }
 }
@@ -546,6 +598,10 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
+    // the number of iterations is known in advance only if the body doesn't compute the continue condition
+    for (auto& buffer : buffers)
+        buffer->reserve(loopBodyConditionOutputIdx == -1 ? max_num_iter : -1);
+
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
@@ -579,6 +635,9 @@ void TensorIterator::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (!isDynamicNode() && canBindSlices(from_mem, to_mem, map_rule) &&
+                 sub_graph.canUseExternalInputMemory(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(std::make_shared<PortSliceBindHelper>(from_mem, to_mem, map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
@@ -587,12 +646,18 @@ void TensorIterator::prepareInputPorts() {
 
 void TensorIterator::prepareOutputPorts() {
     const auto &eng = getEngine();
+    // the body output concatenated to several outer outputs can be bound only to one of them
+    std::unordered_set<int> bound_outputs;
     for (auto map_rule : outputPortMap) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (canBindSlices(to_mem, from_mem, map_rule) &&
+                 sub_graph.canUseExternalOutputMemory(output_edges[map_rule.to]->getChild()) &&
+                 bound_outputs.insert(map_rule.to).second)
+            before_mappers.emplace_back(std::make_shared<PortSliceBindHelper>(to_mem, from_mem, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
     }
@@ -793,6 +858,13 @@ int TensorIterator::getNumIteration(const std::vector<PortMap>& inputPortMap, co
     return numIterations;
 }
 
+size_t TensorIterator::getBoundPortsCount() const {
+    return std::count_if(before_mappers.begin(), before_mappers.end(),
+                         [](const std::shared_ptr<PortMapHelper> &mapper) {
+                             return std::dynamic_pointer_cast<PortSliceBindHelper>(mapper) != nullptr;
+                         });
+}
+
 bool TensorIterator::created() const {
     return getType() == Type::TensorIterator;
 }
@@ -60,13 +60,17 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer has room for the expected number of iterations (if it's known) and grows twice when it's exceeded,
+ * so each iteration output is copied to the buffer only once.
  */
 class DynamicBuffer {
 public:
     DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_);
     ~DynamicBuffer() = default;
 
+    /* the number of iterations to preallocate the buffer for, -1 if it's unknown */
+    void reserve(const int iter_count);
     void execute(const dnnl::engine& eng, const int iter);
     void transfer(const Node* node);
 
@@ -74,9 +78,11 @@ private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
+    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng, const size_t new_capacity);
+    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer, const size_t new_capacity);
     void move_data();
+    /* offset of the first stored chunk, the chunks are placed from the end of the buffer for the negative stride */
+    size_t data_offset_in_byte() const;
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(dnnl::memory& prim);
@@ -84,8 +90,10 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_len = 0lu;     /**< Bytes of the chunk in each of the count outer rows */
+    size_t capacity = 0lu;      /**< Number of the chunks the buffer has room for */
+    size_t num_execs = 0lu;     /**< Number of the stored chunks */
+    int expected_iter_count = -1;
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
@@ -107,6 +115,8 @@ public:
     bool isExecutable() const override { return true; }
 
     void setExtManager(const ExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
+    /// Number of the body ports bound to the slices of the outer tensors instead of copying them on each iteration
+    size_t getBoundPortsCount() const;
 
 protected:
     //  needShapeInfer() should return false
@@ -137,6 +147,8 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<NodePtr> input_nodes;   /// < Body Input nodes in the input_mems order
+    std::vector<EdgePtr> output_edges;  /// < Body Output nodes input edges in the output_mem order
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -88,6 +88,8 @@
 #include "nodes/priorbox.h"
 #include "nodes/priorbox_clustered.h"
 #include "nodes/eye.h"
+#include "nodes/grid_sample.h"
+#include "nodes/random_uniform.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -188,6 +190,8 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(PriorBox, Type::PriorBox);
     INTEL_CPU_NODE(PriorBoxClustered, Type::PriorBoxClustered);
     INTEL_CPU_NODE(Eye, Type::Eye);
+    INTEL_CPU_NODE(GridSample, Type::GridSample);
+    INTEL_CPU_NODE(RandomUniform, Type::RandomUniform);
 }
 
 #undef INTEL_CPU_NODE
@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <ie_mmap_stream.hpp>
 
 #include <pugixml.hpp>
 
@@ -12,6 +13,31 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 namespace {
+    // Refers to the constants data inside the mapped cache entry instead of allocating memory for it
+    class MappedMemoryAllocator : public InferenceEngine::IAllocator {
+    public:
+        MappedMemoryAllocator(std::shared_ptr<ngraph::runtime::AlignedBuffer> memory, size_t offset)
+            : _memory(std::move(memory)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}  // NOLINT
+
+        void* alloc(size_t) noexcept override {
+            return _memory->get_ptr<char>() + _offset;
+        }
+
+        bool free(void*) noexcept override {  // NOLINT
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ngraph::runtime::AlignedBuffer> _memory;
+        size_t _offset;
+    };
+
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -152,10 +178,18 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc constsDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        // the constants of the network read from the mapped stream are the views into the mapping (zero-copy)
+        auto mappedStream = dynamic_cast<InferenceEngine::MappedMemoryStream*>(&_istream);
+        if (mappedStream && hdr.consts_offset + hdr.consts_size <= mappedStream->getMemory()->size()) {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc,
+                std::make_shared<MappedMemoryAllocator>(mappedStream->getMemory(), hdr.consts_offset));
+            dataBlob->allocate();
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -642,6 +642,75 @@ TEST_P(CachingTest, TestLoadCustomImportExport) {
     }
 }
 
+// Brief: the plugins may write a placeholder and rewrite it once the exported data is known (like StreamSerialize)
+TEST_P(CachingTest, TestLoadExportWithSeek) {
+    const std::string placeholder = "00000000";
+    const std::string header = "12345678";
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    auto importNetwork = [&](std::istream& s) {
+        std::string blobHeader(header.size(), ' ');
+        s.read(&blobHeader[0], blobHeader.size());
+        EXPECT_EQ(header, blobHeader);
+        std::string name;
+        s >> name;
+        std::lock_guard<std::mutex> lock(mock_creation_mutex);
+        return createMockIExecutableNet({}, m_inputs_map[name], m_outputs_map[name]);
+    };
+    ON_CALL(*mockPlugin, ImportNetwork(_, _, _)).
+            WillByDefault(Invoke([&](std::istream& s, const RemoteContext::Ptr&,
+                                     const std::map<std::string, std::string> &) {
+        return importNetwork(s);
+    }));
+    ON_CALL(*mockPlugin, ImportNetwork(_, _)).
+            WillByDefault(Invoke([&](std::istream &s, const std::map<std::string, std::string> &) {
+        return importNetwork(s);
+    }));
+
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        ON_CALL(net, Export(_)).WillByDefault(Invoke([&] (std::ostream& s) {
+            const auto headerPos = s.tellp();
+            ASSERT_NE(std::streampos(-1), headerPos);
+            s << placeholder;
+            s << net.get_model()->get_friendly_name();
+            s.seekp(headerPos);
+            s << header;
+            s.seekp(0, std::ios_base::end);
+        }));
+    });
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+        });
+    }
+
+    { // the checksum matches the rewritten data, the blob is imported
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        for (auto& net : networks) {
+            EXPECT_CALL(*net, Export(_)).Times(0);
+        }
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+        });
+    }
+}
+
 // Brief: when LoadNetwork is called from different config - old cache shall not be used
 TEST_P(CachingTest, TestChangeLoadConfig) {
     const std::string CUSTOM_KEY = "CUSTOM_KEY";
@@ -1703,6 +1772,179 @@ TEST_P(CachingTest, TestCacheFileOldVersion) {
     }
 }
 
+TEST_P(CachingTest, TestCacheFileChecksumMismatch) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            EXPECT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}}));
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+    {
+        // Valid header, but the exported network data is modified
+        auto blobs = CommonTestUtils::listFilesWithExt(m_cacheDir, "blob");
+        for (const auto& fileName : blobs) {
+            std::fstream stream(fileName, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+            stream.seekp(-1, std::ios_base::end);
+            stream << '?';
+        }
+    }
+    m_post_mock_net_callbacks.pop_back();
+    { // Step 2. Checksum mismatch, cache will be silently removed
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            EXPECT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}}));
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+    m_post_mock_net_callbacks.pop_back();
+    { // Step 3: same load, should be ok now due to re-creation of cache
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        for (auto& net : networks) {
+            EXPECT_CALL(*net, Export(_)).Times(0);
+        }
+        testLoad([&](Core &ie) {
+            EXPECT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}}));
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+}
+
+// Brief: the blob is corrupted in the middle, far from its beginning and its end
+TEST_P(CachingTest, TestCacheFileCorruptedInTheMiddle) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    const std::string padding(1024 * 1024, 'x');
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        ON_CALL(net, Export(_)).WillByDefault(Invoke([&] (std::ostream& s) {
+            s << net.get_model()->get_friendly_name() << ' ' << padding;
+        }));
+    });
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            EXPECT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}}));
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+    {
+        auto blobs = CommonTestUtils::listFilesWithExt(m_cacheDir, "blob");
+        for (const auto& fileName : blobs) {
+            std::fstream stream(fileName, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+            stream.seekg(0, std::ios_base::end);
+            stream.seekp(stream.tellg() / 2);
+            stream << '?';
+        }
+    }
+    m_post_mock_net_callbacks.pop_back();
+    { // The checksum mismatch, the cache entry is silently replaced
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            EXPECT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}}));
+            EXPECT_NO_THROW(m_testFunction(ie));
+        });
+    }
+}
+
+TEST(CachingTestConfig, TestCacheSizeRejectsInvalidValues) {
+    Core ie;
+    for (const auto& value : {"-1", "-0", "1GB", ""}) {
+        EXPECT_THROW(ie.SetConfig({{ov::cache_size.name(), value}}), Exception) << value;
+    }
+    EXPECT_NO_THROW(ie.SetConfig({{ov::cache_size.name(), "0"}}));
+}
+
+TEST_P(CachingTest, TestCacheSizeLimit) {
+    const std::string CUSTOM_KEY = "CUSTOM_KEY";
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    ON_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).
+            WillByDefault(Invoke([&](const std::string &, const std::map<std::string, Parameter> &) {
+        std::vector<std::string> res;
+        res.push_back(CUSTOM_KEY);
+        return res;
+    }));
+    // The limit is less than any blob size: only the last written one stays in the cache
+    const auto setCacheConfig = [&](Core& ie) {
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {ov::cache_size.name(), "1"}});
+    };
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        EXPECT_CALL(net, Export(_)).Times(1);
+    });
+    for (const auto& value : {"0", "1"}) {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        testLoad([&](Core &ie) {
+            setCacheConfig(ie);
+            m_testFunctionWithCfg(ie, {{CUSTOM_KEY, value}});
+        });
+        EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+    }
+    m_post_mock_net_callbacks.pop_back();
+    { // The last network is imported
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        testLoad([&](Core &ie) {
+            setCacheConfig(ie);
+            m_testFunctionWithCfg(ie, {{CUSTOM_KEY, "1"}});
+        });
+    }
+    { // The first one has been evicted
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        testLoad([&](Core &ie) {
+            setCacheConfig(ie);
+            m_testFunctionWithCfg(ie, {{CUSTOM_KEY, "0"}});
+        });
+    }
+}
+
 TEST_P(CachingTest, LoadHetero_NoCacheMetric) {
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _))
             .Times(AnyNumber()).WillRepeatedly(Return(std::vector<std::string>{}));
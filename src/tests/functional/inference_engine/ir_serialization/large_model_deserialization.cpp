@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/core.hpp"
+
+class LargeModelDeserializationTest : public ::testing::Test {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+
+    // A deep chain of blocks, each of them has a pair of constants and a node with two non constant inputs:
+    // the nodes count is 5 * blocks_count + 2
+    static std::shared_ptr<ov::Model> create_model(size_t blocks_count) {
+        const ov::Shape shape{1, 16};
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        ov::Output<ov::Node> last = data;
+        for (size_t i = 0; i < blocks_count; ++i) {
+            auto add_const = ov::opset8::Constant::create(ov::element::f32, shape, {static_cast<float>(i)});
+            auto mul_const = ov::opset8::Constant::create(ov::element::f32, shape, {static_cast<float>(i % 7)});
+            auto add = std::make_shared<ov::opset8::Add>(last, add_const);
+            auto mul = std::make_shared<ov::opset8::Multiply>(last, mul_const);
+            last = std::make_shared<ov::opset8::Maximum>(add, mul);
+        }
+        auto result = std::make_shared<ov::opset8::Result>(last);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+};
+
+TEST_F(LargeModelDeserializationTest, ReadModelWith50kNodes) {
+    const auto expected = create_model(10000);
+    ov::pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(expected);
+
+    ov::Core core;
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = core.read_model(m_out_xml_path, m_out_bin_path);
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    RecordProperty("read_model_ms", static_cast<int>(duration.count()));
+
+    ASSERT_EQ(expected->get_ops().size(), result->get_ops().size());
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result, expected, true, false, false, true, true);
+    ASSERT_TRUE(success) << message;
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/core.hpp"
+
+class MmapWeightsTest : public ::testing::Test {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+    std::vector<float> m_values = std::vector<float>(1024);
+
+    void SetUp() override {
+        for (size_t i = 0; i < m_values.size(); ++i) {
+            m_values[i] = static_cast<float>(i) / 2;
+        }
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, m_values.size()});
+        auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, m_values.size()}, m_values);
+        auto add = std::make_shared<ov::opset8::Add>(data, weights);
+        auto model = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{data});
+        ov::pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(model);
+    }
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+
+    void check_weights(const std::shared_ptr<ov::Model>& model) const {
+        for (const auto& op : model->get_ordered_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(op)) {
+                ASSERT_EQ(m_values, constant->cast_vector<float>());
+                return;
+            }
+        }
+        FAIL() << "The model has no constants";
+    }
+};
+
+TEST_F(MmapWeightsTest, EnabledByDefault) {
+    ov::Core core;
+    ASSERT_TRUE(core.get_property("", ov::enable_mmap));
+}
+
+TEST_F(MmapWeightsTest, ReadModelWithMappedWeights) {
+    ov::Core core;
+    auto model = core.read_model(m_out_xml_path, m_out_bin_path);
+    check_weights(model);
+}
+
+TEST_F(MmapWeightsTest, ReadModelWithoutMappedWeights) {
+    ov::Core core;
+    core.set_property(ov::enable_mmap(false));
+    ASSERT_FALSE(core.get_property("", ov::enable_mmap));
+    auto model = core.read_model(m_out_xml_path, m_out_bin_path);
+    check_weights(model);
+}
+
+TEST_F(MmapWeightsTest, MappedWeightsOutliveFile) {
+    ov::Core core;
+    auto model = core.read_model(m_out_xml_path);
+    // the mapping keeps the data of the removed file available
+    std::remove(m_out_bin_path.c_str());
+    check_weights(model);
+}
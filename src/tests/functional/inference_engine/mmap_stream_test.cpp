@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "ie_mmap_stream.hpp"
+
+using namespace InferenceEngine;
+
+class MappedMemoryStreamTests : public ::testing::Test {
+protected:
+    const std::string fileName = "mmap_stream_test.blob";
+    const std::string content = "header\nbody of the mapped file";
+
+    void SetUp() override {
+        std::ofstream stream(fileName, std::ios_base::binary);
+        stream << content;
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+};
+
+TEST_F(MappedMemoryStreamTests, canMapFile) {
+    auto memory = mapFile(fileName);
+    ASSERT_NE(nullptr, memory);
+    ASSERT_EQ(content.size(), memory->size());
+    ASSERT_EQ(content, std::string(memory->get_ptr<char>(), memory->size()));
+}
+
+TEST_F(MappedMemoryStreamTests, emptyFileIsNotMapped) {
+    std::ofstream(fileName, std::ios_base::binary | std::ios_base::trunc).close();
+    ASSERT_EQ(nullptr, mapFile(fileName));
+}
+
+TEST_F(MappedMemoryStreamTests, throwsOnMissingFile) {
+    ASSERT_ANY_THROW(mapFile("not_existing_" + fileName));
+}
+
+TEST_F(MappedMemoryStreamTests, canReadAndSeek) {
+    MappedMemoryStream stream(mapFile(fileName));
+
+    std::string line;
+    std::getline(stream, line);
+    ASSERT_EQ("header", line);
+    ASSERT_EQ(7, stream.tellg());
+
+    std::string word;
+    stream >> word;
+    ASSERT_EQ("body", word);
+
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(static_cast<std::streamoff>(content.size()), static_cast<std::streamoff>(stream.tellg()));
+
+    stream.seekg(12);
+    char buf[2] = {};
+    stream.read(buf, 2);
+    ASSERT_EQ(2, stream.gcount());
+    ASSERT_EQ("of", std::string(buf, 2));
+
+    stream.seekg(-4, std::ios_base::end);
+    stream >> word;
+    ASSERT_EQ("file", word);
+    ASSERT_TRUE(stream.eof());
+}
+
+TEST_F(MappedMemoryStreamTests, memoryOutlivesStream) {
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> memory;
+    {
+        MappedMemoryStream stream(mapFile(fileName));
+        memory = stream.getMemory();
+    }
+    std::remove(fileName.c_str());
+    ASSERT_EQ(content, std::string(memory->get_ptr<char>(), memory->size()));
+}
@@ -2,11 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <iostream>
+#include <mutex>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
@@ -189,6 +195,23 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+TEST_F(StreamsExecutorConfigTest, workStealingIsSetByConfigKey) {
+    IStreamsExecutor::Config config;
+    const auto keys = config.SupportedKeys();
+    ASSERT_NE(keys.end(), std::find(keys.begin(), keys.end(), CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)));
+    ASSERT_EQ(CONFIG_VALUE(NO), config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)).as<std::string>());
+
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), CONFIG_VALUE(YES));
+    ASSERT_TRUE(config._workStealing);
+    ASSERT_EQ(CONFIG_VALUE(YES), config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)).as<std::string>());
+    // the default multithreaded config keeps the queues mode
+    ASSERT_TRUE(IStreamsExecutor::Config::MakeDefaultMultiThreaded(config)._workStealing);
+
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), CONFIG_VALUE(NO));
+    ASSERT_FALSE(config._workStealing);
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), "ON"), Exception);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -208,6 +231,20 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._prioritized = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -233,10 +270,191 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._prioritized = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
     }
 );
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+#if !(defined(__APPLE__) || defined(_WIN32)) && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+// The parallel branches of the CPU graph are executed in the nested arenas, the stream thread must keep its core
+TEST(CPUStreamsExecutorBindingTests, streamThreadKeepsCoreAfterNestedArenas) {
+    if (getNumberOfCPUCores() < 4) {
+        GTEST_SKIP();
+    }
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 1, 4, IStreamsExecutor::ThreadBindingType::CORES};
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    cpu_set_t before, after;
+    CPU_ZERO(&before);
+    CPU_ZERO(&after);
+    for (int wave = 0; wave < 3; wave++) {
+        std::atomic<int> executed{0};
+        async(executor, [&] {
+            sched_getaffinity(0, sizeof(before), &before);
+            executor->ExecuteNested({[&] {executed++;}, [&] {executed++;}}, 2);
+            sched_getaffinity(0, sizeof(after), &after);
+        }).wait();
+        EXPECT_EQ(2, executed.load());
+        EXPECT_EQ(1, CPU_COUNT(&before)) << "wave " << wave;
+        EXPECT_TRUE(CPU_EQUAL(&before, &after)) << "wave " << wave;
+    }
+}
+#endif
+
+// The hints are served in the same order with the shared queue and with the work stealing queues
+class CPUStreamsExecutorPriorityTests : public ::testing::TestWithParam<bool> {
+protected:
+    // a single stream executor, that is kept busy until the returned promise is set
+    std::promise<void> makeBlockedExecutor(int priorityAging) {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = GetParam();
+        config._prioritized = true;
+        config._priorityAging = priorityAging;
+        executor = std::make_shared<CPUStreamsExecutor>(config);
+        std::promise<void> unblock;
+        auto blocked = std::make_shared<std::shared_future<void>>(unblock.get_future().share());
+        executor->run([blocked] {
+            blocked->wait();
+        });
+        return unblock;
+    }
+
+    std::future<void> run(char name,
+                          ov::hint::Priority priorityClass,
+                          std::chrono::steady_clock::time_point deadline = {}) {
+        IStreamsExecutor::TaskPriority priority;
+        priority._priority = priorityClass;
+        priority._deadline = deadline;
+        auto task = std::make_shared<std::packaged_task<void()>>([this, name] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+        });
+        auto future = task->get_future();
+        executor->RunWithPriority([task] {(*task)();}, priority);
+        return future;
+    }
+
+    CPUStreamsExecutor::Ptr executor;
+    std::mutex mutex;
+    std::string order;
+};
+
+TEST_P(CPUStreamsExecutorPriorityTests, higherPriorityTasksAreServedFirst) {
+    auto unblock = makeBlockedExecutor(10000);
+    auto low = run('L', ov::hint::Priority::LOW);
+    auto medium = run('M', ov::hint::Priority::MEDIUM);
+    auto high = run('H', ov::hint::Priority::HIGH);
+    unblock.set_value();
+    low.get(); medium.get(); high.get();
+
+    ASSERT_EQ("HML", order);
+    auto statistics = executor->GetQueueStatistics();
+    ASSERT_EQ(uint64_t(1), statistics[ov::hint::Priority::LOW]._tasks);
+    // the blocking task is queued before any hint is given, so it is served in the FIFO mode and isn't counted
+    ASSERT_EQ(uint64_t(1), statistics[ov::hint::Priority::MEDIUM]._tasks);
+    ASSERT_EQ(uint64_t(1), statistics[ov::hint::Priority::HIGH]._tasks);
+    ASSERT_EQ(uint64_t(0), statistics[ov::hint::Priority::LOW]._missedDeadlines);
+}
+
+TEST_P(CPUStreamsExecutorPriorityTests, defaultHintsKeepFifoQueue) {
+    auto unblock = makeBlockedExecutor(10000);
+    auto first = run('A', ov::hint::Priority::MEDIUM);
+    auto second = run('B', ov::hint::Priority::MEDIUM);
+    unblock.set_value();
+    first.get(); second.get();
+
+    ASSERT_EQ("AB", order);
+    // the priority queue isn't turned on, so nothing is timed
+    ASSERT_TRUE(executor->GetQueueStatistics().empty());
+}
+
+TEST_P(CPUStreamsExecutorPriorityTests, tasksQueuedBeforeHintsAreServedFirst) {
+    auto unblock = makeBlockedExecutor(10000);
+    auto fifo = run('F', ov::hint::Priority::MEDIUM);
+    auto high = run('H', ov::hint::Priority::HIGH);
+    unblock.set_value();
+    fifo.get(); high.get();
+
+    ASSERT_EQ("FH", order);
+}
+
+TEST_P(CPUStreamsExecutorPriorityTests, waitingTasksAreNotStarved) {
+    auto unblock = makeBlockedExecutor(0);
+    auto low = run('L', ov::hint::Priority::LOW);
+    auto high = run('H', ov::hint::Priority::HIGH);
+    unblock.set_value();
+    low.get(); high.get();
+
+    ASSERT_EQ("LH", order);
+}
 
+TEST_P(CPUStreamsExecutorPriorityTests, earliestDeadlineIsServedFirst) {
+    auto unblock = makeBlockedExecutor(10000);
+    const auto now = std::chrono::steady_clock::now();
+    auto late = run('L', ov::hint::Priority::MEDIUM, now + std::chrono::seconds{2});
+    auto early = run('E', ov::hint::Priority::MEDIUM, now + std::chrono::seconds{1});
+    auto missed = run('M', ov::hint::Priority::LOW, now - std::chrono::milliseconds{1});
+    unblock.set_value();
+    late.get(); early.get(); missed.get();
+
+    ASSERT_EQ("MEL", order);
+    auto statistics = executor->GetQueueStatistics();
+    ASSERT_EQ(uint64_t(1), statistics[ov::hint::Priority::LOW]._missedDeadlines);
+}
+
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorPriorityTests, CPUStreamsExecutorPriorityTests, ::testing::Bool());
+
+
+
+
+// Microbenchmark of the task queue under a high rate of small tasks submitted from many client threads.
+// It is disabled by default, run it with --gtest_also_run_disabled_tests to compare the queue modes.
+class CPUStreamsExecutorQueuePerfTests : public ::testing::TestWithParam<bool> {};
+
+TEST_P(CPUStreamsExecutorQueuePerfTests, DISABLED_smallTasksThroughput) {
+    const int streams = getNumberOfCPUCores();
+    const int clients = 2 * streams;
+    constexpr int tasksPerClient = 100000;
+
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._workStealing = GetParam();
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+    std::atomic<int> done{0};
+    std::promise<void> allDone;
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> clientThreads;
+    for (int c = 0; c < clients; ++c) {
+        clientThreads.emplace_back([&] {
+            for (int t = 0; t < tasksPerClient; ++t) {
+                executor->run([&] {
+                    if (++done == clients * tasksPerClient)
+                        allDone.set_value();
+                });
+            }
+        });
+    }
+    for (auto& thread : clientThreads)
+        thread.join();
+    allDone.get_future().wait();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << (GetParam() ? "work stealing" : "shared queue") << ": " << clients * tasksPerClient << " tasks, "
+              << streams << " streams, " << clients << " clients: " << elapsed.count() << " us ("
+              << 1e6 * clients * tasksPerClient / elapsed.count() << " tasks/s)" << std::endl;
+}
 
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorQueuePerfTests, CPUStreamsExecutorQueuePerfTests, ::testing::Bool());
@@ -9,6 +9,8 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/opsets/opset8.hpp"
 
 #include <gtest/gtest.h>
 
@@ -113,6 +115,76 @@ TEST_F(OVClassConfigTestCPU, smoke_CheckModelStreamsHasHigherPriorityThanThrough
     ASSERT_EQ(streams, value);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CheckZeroCopyPortsReportsAllPorts) {
+    ov::Core ie;
+    std::map<std::string, bool> zeroCopyPorts;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+
+    ASSERT_NO_THROW(zeroCopyPorts = compiledModel.get_property(ov::intel_cpu::zero_copy_ports));
+    ASSERT_EQ(model->inputs().size() + model->outputs().size(), zeroCopyPorts.size());
+    for (const auto& input : model->inputs()) {
+        ASSERT_EQ(1, zeroCopyPorts.count("input:" + input.get_node()->get_friendly_name()));
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckZeroCopyPortsValues) {
+    ov::Core ie;
+    std::map<std::string, bool> zeroCopyPorts;
+
+    // the input feeds both ports of the eltwise, so it can't be executed in place and the input memory is not
+    // overwritten, the planar output is produced directly by the eltwise
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 16});
+    param->set_friendly_name("data");
+    auto add = std::make_shared<ov::opset8::Add>(param, param);
+    add->set_friendly_name("add");
+    auto result = std::make_shared<ov::opset8::Result>(add);
+    auto addModel = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    ov::CompiledModel compiledModel = ie.compile_model(addModel, deviceName);
+
+    ASSERT_NO_THROW(zeroCopyPorts = compiledModel.get_property(ov::intel_cpu::zero_copy_ports));
+    ASSERT_EQ(size_t(2), zeroCopyPorts.size());
+    ASSERT_TRUE(zeroCopyPorts.at("input:data"));
+    ASSERT_TRUE(zeroCopyPorts.at("output:add"));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckZeroCopyPortsInputAndOutputWithSameName) {
+    ov::Core ie;
+    std::map<std::string, bool> zeroCopyPorts;
+
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 16});
+    param->set_friendly_name("data");
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    relu->set_friendly_name("data");
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    auto sameNameModel = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    ov::CompiledModel compiledModel = ie.compile_model(sameNameModel, deviceName);
+
+    ASSERT_NO_THROW(zeroCopyPorts = compiledModel.get_property(ov::intel_cpu::zero_copy_ports));
+    ASSERT_EQ(size_t(2), zeroCopyPorts.size());
+    ASSERT_EQ(size_t(1), zeroCopyPorts.count("input:data"));
+    ASSERT_EQ(size_t(1), zeroCopyPorts.count("output:data"));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckQueueingStatisticsPerRequestPriority) {
+    ov::Core ie;
+    std::map<std::string, uint64_t> stats;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.set_property(ov::hint::request_priority(ov::hint::Priority::HIGH),
+                                         ov::hint::request_deadline(1000)));
+    ASSERT_EQ(ov::hint::Priority::HIGH, request.get_property(ov::hint::request_priority));
+    request.start_async();
+    request.wait();
+
+    ASSERT_NO_THROW(stats = compiledModel.get_property(ov::intel_cpu::queueing_statistics));
+    ASSERT_EQ(uint64_t(1), stats["HIGH:tasks"]);
+    ASSERT_EQ(size_t(0), stats.count("LOW:tasks"));
+}
+
 const std::vector<ov::AnyMap> multiDevicePriorityConfigs = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU)}};
 
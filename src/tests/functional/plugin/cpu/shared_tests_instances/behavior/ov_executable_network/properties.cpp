@@ -31,6 +31,7 @@ const std::vector<ov::AnyMap> auto_inproperties = {
 const std::vector<ov::AnyMap> auto_batch_inproperties = {
         {ov::num_streams(-100)},
         {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"}, {ov::auto_batch_timeout(-1)}},
+        {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"}, {ov::auto_batch_latency_slo(-1)}},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVCompiledModelPropertiesIncorrectTests,
@@ -101,6 +102,10 @@ const std::vector<ov::AnyMap> hetero_properties = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::num_streams(ov::streams::AUTO)},
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU),
          {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, InferenceEngine::PluginConfigParams::CPU_THROUGHPUT_AUTO}},
+        {ov::device::priorities(CommonTestUtils::DEVICE_CPU),
+         {HETERO_CONFIG_KEY(PIPELINE), InferenceEngine::PluginConfigParams::YES}},
+        {ov::device::priorities(CommonTestUtils::DEVICE_CPU),
+         {HETERO_CONFIG_KEY(COST_BASED_PARTITIONING), InferenceEngine::PluginConfigParams::YES}},
 };
 
 
@@ -114,6 +119,10 @@ const std::vector<ov::AnyMap> auto_batch_properties = {
         {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"}},
         {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"}, {CONFIG_KEY(AUTO_BATCH_TIMEOUT) , "1"}},
         {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"}, {ov::auto_batch_timeout(10)}},
+        {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"}, {ov::auto_batch_timeout(10)},
+         {ov::auto_batch_latency_slo(50)}},
+        {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"},
+         {ov::auto_batch_partial_batches(true)}},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVCompiledModelPropertiesTests,
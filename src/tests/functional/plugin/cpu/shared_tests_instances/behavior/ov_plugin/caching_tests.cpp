@@ -6,6 +6,8 @@
 #include <ngraph_ops/nms_ie_internal.hpp>
 #include <ngraph_ops/nms_static_shape_ie.hpp>
 #include <ngraph_ops/multiclass_nms_ie_internal.hpp>
+#include "common_test_utils/file_utils.hpp"
+#include "openvino/runtime/core.hpp"
 
 using namespace ov::test::behavior;
 using namespace ngraph;
@@ -128,4 +130,53 @@ namespace {
                                     ::testing::ValuesIn(autoConfigs)),
                             CompileModelCacheTestBase::getTestCaseName);
 
+    static ov::Tensor inferConvPoolRelu(ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        auto input = request.get_input_tensor();
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++) {
+            data[i] = static_cast<float>(i % 17) - 8.f;
+        }
+        request.infer();
+        const auto output = request.get_output_tensor();
+        ov::Tensor result(output.get_element_type(), output.get_shape());
+        output.copy_to(result);
+        return result;
+    }
+
+    static void compareTensors(const ov::Tensor& expected, const ov::Tensor& actual) {
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        ASSERT_EQ(0, memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+    }
+
+    // The CPU blob header is rewritten once the blob is serialized, the export through the cache and the import from
+    // the memory mapped cache entry must produce the same results as the compiled model
+    TEST(CPUCachingTest, smoke_ExportImportCompareOutputs) {
+        const std::string cacheDir = "CPUCachingTest_ExportImportCompareOutputs";
+        auto model = ngraph::builder::subgraph::makeConvPoolRelu({1, 3, 32, 32});
+        ov::Core core;
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+        ASSERT_FALSE(compiledModel.get_property(ov::loaded_from_cache));
+        const auto reference = inferConvPoolRelu(compiledModel);
+
+        std::stringstream blob;
+        compiledModel.export_model(blob);
+        auto importedModel = core.import_model(blob, CommonTestUtils::DEVICE_CPU);
+        ASSERT_TRUE(importedModel.get_property(ov::loaded_from_cache));
+        compareTensors(reference, inferConvPoolRelu(importedModel));
+
+        core.set_property(ov::cache_dir(cacheDir));
+        for (int i = 0; i < 2; i++) {
+            // the first iteration exports the blob to the cache, the second one imports it
+            auto cachedModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+            ASSERT_EQ(size_t(1), CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+            // the cache entry must be imported rather than silently recompiled
+            ASSERT_EQ(i == 1, cachedModel.get_property(ov::loaded_from_cache));
+            compareTensors(reference, inferConvPoolRelu(cachedModel));
+        }
+        core.set_property(ov::cache_dir());
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
 } // namespace
@@ -4,6 +4,7 @@
 
 #include "behavior/ov_plugin/core_integration.hpp"
 #include <openvino/runtime/properties.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include "ie_system_conf.h"
 #include "openvino/runtime/core.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -248,6 +249,36 @@ TEST(OVClassBasicTest, smoke_SetConfigEnableProfiling) {
     ASSERT_EQ(enableProfiling, value);
 }
 
+TEST(OVClassBasicTest, smoke_SetConfigNumaPolicy) {
+    ov::Core ie;
+    auto value = ov::intel_cpu::NumaPolicy::SHARED;
+
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::numa_policy));
+    ASSERT_EQ(ov::intel_cpu::NumaPolicy::REPLICATE, value);
+
+    for (const auto policy : {ov::intel_cpu::NumaPolicy::LOCAL,
+                              ov::intel_cpu::NumaPolicy::SHARED,
+                              ov::intel_cpu::NumaPolicy::REPLICATE}) {
+        OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::intel_cpu::numa_policy(policy)));
+        OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::numa_policy));
+        ASSERT_EQ(policy, value);
+    }
+
+    ASSERT_THROW(ie.set_property("CPU", {{ov::intel_cpu::numa_policy.name(), "INTERLEAVE"}}), ov::Exception);
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::numa_policy));
+    ASSERT_EQ(ov::intel_cpu::NumaPolicy::REPLICATE, value);
+}
+
+TEST(OVClassBasicTest, smoke_NumaPolicyIsSupportedProperty) {
+    ov::Core ie;
+    std::vector<ov::PropertyName> properties;
+
+    OV_ASSERT_NO_THROW(properties = ie.get_property("CPU", ov::supported_properties));
+    auto it = std::find(properties.begin(), properties.end(), ov::intel_cpu::numa_policy.name());
+    ASSERT_NE(properties.end(), it);
+    ASSERT_TRUE(it->is_mutable());
+}
+
 // IE Class Query network
 
 INSTANTIATE_TEST_SUITE_P(
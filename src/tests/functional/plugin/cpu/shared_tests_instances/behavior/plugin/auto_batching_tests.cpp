@@ -18,6 +18,25 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test,
                 ::testing::ValuesIn(num_requests),
                 ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test::getTestCaseName);
+
+// the partially collected batches (the number of requests is not a multiple of the batch size)
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_PartialBatches,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(get_vs_set),
+                ::testing::Values(1),
+                ::testing::Values(3, 9),
+                ::testing::Values(4, 8)),
+                         AutoBatching_Test_PartialBatches::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_PartialBatchLadder,
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        AutoBatching_Test_PartialBatchLadder::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_AdaptiveTimeout,
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        AutoBatching_Test_AdaptiveTimeout::getTestCaseName);
+
 // TODO: for 22.2 (CVS-68949)
 //INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_DetectionOutput,
 //                         ::testing::Combine(
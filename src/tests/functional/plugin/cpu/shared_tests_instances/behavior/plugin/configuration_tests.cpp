@@ -3,6 +3,8 @@
 //
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_system_conf.h"
 #include "behavior/plugin/configuration_tests.hpp"
 
@@ -54,6 +56,13 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT, "4"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_POLICY, "REPLICATE"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_POLICY, "LOCAL"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_POLICY, "SHARED"}},
+            {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_STREAMS_WORK_STEALING, InferenceEngine::PluginConfigParams::YES},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}},
             // check that hints doesn't override customer value (now for streams and later for other config opts)
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT},
              {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "3"}},
@@ -147,7 +156,12 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "should be int"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WARMUP_SHAPES_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_POLICY, "local"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_POLICY, "NUMA"}},
+            {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_STREAMS_WORK_STEALING, "ON"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -152,4 +152,27 @@ const auto nmsParamsDynamic_smoke2 = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU));
 
 INSTANTIATE_TEST_SUITE_P(smoke_MulticlassNmsLayerTest_static2, MulticlassNmsLayerTest, nmsParamsStatic_smoke2, MulticlassNmsLayerTest::getTestCaseName);
-INSTANTIATE_TEST_SUITE_P(smoke_MulticlassNmsLayerTest_dynamic2, MulticlassNmsLayerTest, nmsParamsDynamic_smoke2, MulticlassNmsLayerTest::getTestCaseName);
\ No newline at end of file
+INSTANTIATE_TEST_SUITE_P(smoke_MulticlassNmsLayerTest_dynamic2, MulticlassNmsLayerTest, nmsParamsDynamic_smoke2, MulticlassNmsLayerTest::getTestCaseName);
+
+/* the detector sized inputs: the scores are quantized to 1e-3, so most of the candidates are tied by the score */
+const std::vector<std::vector<ov::Shape>> inStaticShapeParamsManyAnchors = {
+    {{1, 20000, 4}, {1, 3, 20000}}
+};
+
+const auto nmsParamsStatic_manyAnchors = ::testing::Combine(
+    ::testing::ValuesIn(ov::test::static_shapes_to_test_representation(inStaticShapeParamsManyAnchors)),
+    ::testing::Combine(::testing::Values(ov::element::f32),
+                       ::testing::Values(ov::element::i32),
+                       ::testing::Values(ov::element::i32),
+                       ::testing::Values(ov::element::f32)),
+    ::testing::Values(200, -1),
+    ::testing::Combine(::testing::ValuesIn(iouThreshold), ::testing::ValuesIn(scoreThreshold), ::testing::Values(1.0f)),
+    ::testing::Values(-1),
+    ::testing::Values(-1),
+    ::testing::Values(element::i32),
+    ::testing::Values(ov::op::util::MulticlassNmsBase::SortResultType::SCORE,
+                      ov::op::util::MulticlassNmsBase::SortResultType::CLASSID),
+    ::testing::Combine(::testing::Values(false), ::testing::Values(true)),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MulticlassNmsLayerTest_manyAnchors, MulticlassNmsLayerTest, nmsParamsStatic_manyAnchors, MulticlassNmsLayerTest::getTestCaseName);
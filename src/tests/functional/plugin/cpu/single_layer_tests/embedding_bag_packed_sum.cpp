@@ -69,6 +69,9 @@ protected:
 
         selectedType = makeSelectedTypeStr("ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the bf16 table is accumulated in fp32, while the reference accumulates in bf16
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2;
 
         init_input_shapes({ inputShapes });
 
@@ -94,11 +97,17 @@ TEST_P(EmbeddingBagPackedSumLayerCPUTest, CompareWithRefs) {
 
 namespace {
 
-const std::vector<ElementType> netPrecisions = {
+std::vector<ElementType> netPrecisions() {
+    std::vector<ElementType> precisions = {
         ElementType::f32,
         ElementType::i32,
-        ElementType::u8
-};
+        ElementType::u8,
+        ElementType::i8
+    };
+    if (InferenceEngine::with_cpu_x86_avx512_core())
+        precisions.push_back(ElementType::bf16);
+    return precisions;
+}
 
 const std::vector<ElementType> indPrecisions = {
         ElementType::i64,
@@ -144,7 +153,7 @@ const auto embBagPackedSumArgSet = ::testing::Combine(
 INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
         ::testing::Combine(
                 embBagPackedSumArgSet,
-                ::testing::ValuesIn(netPrecisions),
+                ::testing::ValuesIn(netPrecisions()),
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
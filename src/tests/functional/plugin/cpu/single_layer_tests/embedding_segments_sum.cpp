@@ -79,6 +79,9 @@ protected:
 
         selectedType = makeSelectedTypeStr("ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the bf16 table is accumulated in fp32, while the reference accumulates in bf16
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2;
 
         init_input_shapes({ inputShapes });
 
@@ -107,11 +110,17 @@ TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
 }
 
 namespace {
-const std::vector<ElementType> netPrecisions = {
+std::vector<ElementType> netPrecisions() {
+    std::vector<ElementType> precisions = {
         ElementType::f32,
         ElementType::i32,
-        ElementType::u8
-};
+        ElementType::u8,
+        ElementType::i8
+    };
+    if (InferenceEngine::with_cpu_x86_avx512_core())
+        precisions.push_back(ElementType::bf16);
+    return precisions;
+}
 
 const std::vector<ElementType> indPrecisions = {
         ElementType::i64,
@@ -165,7 +174,7 @@ const auto embSegmentsSumArgSet = ::testing::Combine(
 INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
      ::testing::Combine(
          embSegmentsSumArgSet,
-         ::testing::ValuesIn(netPrecisions),
+         ::testing::ValuesIn(netPrecisions()),
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
@@ -0,0 +1,208 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/op/grid_sample.hpp>
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using GridSampleOp = ov::op::v9::GridSample;
+
+namespace CPULayerTestsDefinitions {
+
+using GridSampleLayerTestCPUParams = std::tuple<
+        std::vector<InputShape>,            // data and grid shapes
+        bool,                               // align corners
+        GridSampleOp::InterpolationMode,    // interpolation mode
+        GridSampleOp::PaddingMode,          // padding mode
+        ElementType,                        // data precision
+        CPUSpecificParams,                  // CPU specific params
+        std::map<std::string, std::string>  // additional config
+>;
+
+class GridSampleLayerTestCPU : public testing::WithParamInterface<GridSampleLayerTestCPUParams>,
+                               virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<GridSampleLayerTestCPUParams> obj) {
+        std::vector<InputShape> inputShapes;
+        bool alignCorners;
+        GridSampleOp::InterpolationMode interpolationMode;
+        GridSampleOp::PaddingMode paddingMode;
+        ElementType dataPrecision;
+        CPUSpecificParams cpuParams;
+        std::map<std::string, std::string> additionalConfig;
+        std::tie(inputShapes, alignCorners, interpolationMode, paddingMode, dataPrecision, cpuParams, additionalConfig) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=(";
+        for (const auto& shape : inputShapes) {
+            result << CommonTestUtils::partialShape2str({shape.first}) << "_";
+        }
+        result << ")_TS=";
+        for (size_t i = 0lu; i < inputShapes.front().second.size(); i++) {
+            result << "{";
+            for (const auto& shape : inputShapes) {
+                result << CommonTestUtils::vec2str(shape.second[i]) << "_";
+            }
+            result << "}_";
+        }
+        result << "alignCorners=" << (alignCorners ? "True" : "False") << "_";
+        result << "mode=" << interpolationMode << "_";
+        result << "padding=" << paddingMode << "_";
+        result << "netPrc=" << dataPrecision << "_";
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        if (!additionalConfig.empty()) {
+            result << "_PluginConf";
+            for (auto& item : additionalConfig) {
+                if (item.second == InferenceEngine::PluginConfigParams::YES)
+                    result << "_" << item.first << "=" << item.second;
+            }
+        }
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<InputShape> inputShapes;
+        bool alignCorners;
+        GridSampleOp::InterpolationMode interpolationMode;
+        GridSampleOp::PaddingMode paddingMode;
+        ElementType dataPrecision;
+        CPUSpecificParams cpuParams;
+        std::map<std::string, std::string> additionalConfig;
+        std::tie(inputShapes, alignCorners, interpolationMode, paddingMode, dataPrecision, cpuParams, additionalConfig) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes(inputShapes);
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
+
+        if (additionalConfig[InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16] == InferenceEngine::PluginConfigParams::YES &&
+                InferenceEngine::with_cpu_x86_avx512_core()) {
+            selectedType = makeSelectedTypeStr(selectedType, ElementType::bf16);
+            rel_threshold = 1e-2;
+        } else {
+            selectedType = makeSelectedTypeStr(selectedType, dataPrecision);
+        }
+
+        ngraph::ParameterVector params {
+            std::make_shared<ov::op::v0::Parameter>(dataPrecision, inputDynamicShapes[0]),
+            std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[1])
+        };
+        params[0]->set_friendly_name("data");
+        params[1]->set_friendly_name("grid");
+        const GridSampleOp::Attributes attributes{alignCorners, interpolationMode, paddingMode};
+        auto gridSample = std::make_shared<GridSampleOp>(params[0], params[1], attributes);
+
+        function = makeNgraphFunction(dataPrecision, params, gridSample, "GridSampleCPU");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        const auto& funcInputs = function->inputs();
+        inputs.clear();
+
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::Tensor tensor;
+            if (funcInput.get_node()->get_friendly_name() == "grid") {
+                // the coordinates slightly exceed the [-1, 1] range to check the padding
+                tensor = ov::Tensor(funcInput.get_element_type(), targetInputStaticShapes[i]);
+                auto* gridData = tensor.data<float>();
+                for (size_t j = 0; j < tensor.get_size(); ++j) {
+                    gridData[j] = -1.25f + 2.5f * static_cast<float>((j * 37) % 101) / 100.f;
+                }
+            } else {
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], 10, 0, 10);
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(GridSampleLayerTestCPU, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckPluginRelatedResults(compiledModel, "GridSample");
+}
+
+namespace {
+
+std::vector<CPUSpecificParams> filterCPUInfoForDevice() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{nchw, nchw}, {nchw}, {}, "ref"});
+    resCPUParams.push_back(CPUSpecificParams{{nhwc, nchw}, {nhwc}, {}, "ref"});
+    if (InferenceEngine::with_cpu_x86_avx512_core()) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw16c, nchw}, {nChw16c}, {}, "ref"});
+    } else {
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c, nchw}, {nChw8c}, {}, "ref"});
+    }
+    return resCPUParams;
+}
+
+const std::vector<GridSampleOp::InterpolationMode> interpolationModes = {
+    GridSampleOp::InterpolationMode::BILINEAR,
+    GridSampleOp::InterpolationMode::BICUBIC,
+    GridSampleOp::InterpolationMode::NEAREST
+};
+
+const std::vector<GridSampleOp::PaddingMode> paddingModes = {
+    GridSampleOp::PaddingMode::ZEROS,
+    GridSampleOp::PaddingMode::BORDER,
+    GridSampleOp::PaddingMode::REFLECTION
+};
+
+const std::vector<std::vector<InputShape>> staticInputShapes = {
+    {{{}, {{2, 3, 5, 7}}}, {{}, {{2, 4, 6, 2}}}},
+    {{{}, {{1, 19, 9, 11}}}, {{}, {{1, 8, 13, 2}}}},
+    {{{}, {{1, 5, 1, 1}}}, {{}, {{1, 3, 3, 2}}}}
+};
+
+const std::vector<std::vector<InputShape>> dynamicInputShapes = {
+    {{{-1, 17, -1, -1}, {{1, 17, 5, 6}, {2, 17, 8, 3}, {1, 17, 5, 6}}},
+     {{-1, -1, -1, 2}, {{1, 7, 9, 2}, {2, 4, 4, 2}, {1, 11, 3, 2}}}}
+};
+
+const std::vector<std::map<std::string, std::string>> additionalConfig = {
+    {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO}},
+    {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_GridSampleStatic, GridSampleLayerTestCPU,
+                ::testing::Combine(
+                    ::testing::ValuesIn(staticInputShapes),
+                    ::testing::Values(true, false),
+                    ::testing::ValuesIn(interpolationModes),
+                    ::testing::ValuesIn(paddingModes),
+                    ::testing::Values(ElementType::f32),
+                    ::testing::ValuesIn(filterCPUInfoForDevice()),
+                    ::testing::Values(additionalConfig[0])),
+                GridSampleLayerTestCPU::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_GridSampleDynamic, GridSampleLayerTestCPU,
+                ::testing::Combine(
+                    ::testing::ValuesIn(dynamicInputShapes),
+                    ::testing::Values(true, false),
+                    ::testing::ValuesIn(interpolationModes),
+                    ::testing::ValuesIn(paddingModes),
+                    ::testing::Values(ElementType::f32),
+                    ::testing::ValuesIn(filterCPUInfoForDevice()),
+                    ::testing::Values(additionalConfig[0])),
+                GridSampleLayerTestCPU::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_GridSampleBF16, GridSampleLayerTestCPU,
+                ::testing::Combine(
+                    ::testing::ValuesIn(staticInputShapes),
+                    ::testing::Values(false),
+                    ::testing::ValuesIn(interpolationModes),
+                    ::testing::Values(GridSampleOp::PaddingMode::ZEROS),
+                    ::testing::Values(ElementType::f32),
+                    ::testing::ValuesIn(filterCPUInfoForDevice()),
+                    ::testing::Values(additionalConfig[1])),
+                GridSampleLayerTestCPU::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
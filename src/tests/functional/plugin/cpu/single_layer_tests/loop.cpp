@@ -299,6 +299,71 @@ protected:
     }
 };
 
+class LoopForConcatReverseLayerCPUTest : public LoopLayerCPUTest {
+    // body:
+    // while (i + 1 < 7)
+    //  x += 1
+    // the output concatenates x in the reverse order, so the number of the iterations is known only after the loop
+
+protected:
+    void SetUp() override {
+        InputLayerType trip_count_type;
+        int64_t trip_count;
+        bool exec_cond;
+        std::vector<InputShape> shapes;
+        std::vector<LOOP_IN_TYPE> types;
+        std::tie(trip_count_type, trip_count, exec_cond, shapes, types, inType) = this->GetParam();
+
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes(shapes);
+
+        auto params = ngraph::builder::makeDynamicParams(inType, inputDynamicShapes);
+
+        // Body parameters
+        ngraph::ParameterVector body_params = {
+            std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i64, ngraph::Shape{1}),
+            std::make_shared<ngraph::opset1::Parameter>(inType, ngraph::PartialShape::dynamic())
+        };
+
+        auto exec_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, exec_cond);
+        std::shared_ptr<ngraph::Node> trip_count_input;
+        if (trip_count_type == InputLayerType::PARAMETER) {
+            for (auto& target : targetStaticShapes)
+                target.insert(target.begin(), ngraph::Shape{1});
+            trip_count_input = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::i64, ngraph::Shape{1});
+            trip_count_input->set_friendly_name("trip_count");
+            params.insert(params.begin(), ov::as_type_ptr<ngraph::opset5::Parameter>(trip_count_input));
+        } else {
+            trip_count_input = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, trip_count);
+        }
+
+        // Body
+        auto const_iter_step = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, 1);
+        auto const_body_cond = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, 7);
+        auto next_iter = std::make_shared<ngraph::opset5::Add>(body_params[0], const_iter_step);
+        auto less = std::make_shared<ngraph::opset5::Less>(next_iter, const_body_cond);
+
+        auto node_const = std::make_shared<ngraph::opset5::Constant>(inType, ngraph::Shape{}, 1);
+        auto node = std::make_shared<ngraph::opset5::Add>(body_params[1], node_const);
+
+        auto body = std::make_shared<ov::Model>(ngraph::OutputVector{less, node}, body_params);
+
+        auto loop = std::make_shared<ngraph::opset5::Loop>(trip_count_input, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{0, 0});
+
+        loop->set_merged_input(body_params[1], params.back(), node);
+
+        auto out0 = loop->get_iter_value(node, -1);
+        // start=-1, stride=-1, part_size=1, end=0, axis=1
+        auto out1 = loop->get_concatenated_slices(node, -1, -1, 1, 0, 1);
+
+        auto result0 = std::make_shared<ngraph::opset5::Result>(out0);
+        auto result1 = std::make_shared<ngraph::opset5::Result>(out1);
+        function = std::make_shared<ov::Model>(ngraph::ResultVector{result0, result1}, params, "loop");
+    }
+};
+
 TEST_P(LoopLayerCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
 
@@ -317,6 +382,12 @@ TEST_P(LoopForDiffShapesLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+TEST_P(LoopForConcatReverseLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
 namespace {
 
 const std::vector<ElementType> inputPrecisions = {
@@ -477,5 +548,16 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForDiffShapesConcat, LoopForDiffShapesLayerCP
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the body stops the loop after 7 iterations, so the concatenation buffer grows on the way
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcatReverse, LoopForConcatReverseLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(trip_count_type),
+                                 ::testing::Values(10, -1),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs_3),
+                                 ::testing::Values(std::vector<LOOP_IN_TYPE>{}),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
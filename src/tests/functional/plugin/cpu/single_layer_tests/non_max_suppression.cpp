@@ -436,4 +436,27 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// the detector sized inputs: the scores are quantized to 1e-3, so most of the candidates are tied by the score
+// and the order is decided by the box index, while only a part of them is sorted on demand
+const std::vector<InputShapeParams> inShapeParamsManyAnchors = {
+    InputShapeParams{std::vector<ov::Dimension>{}, std::vector<TargetShapeParams>{TargetShapeParams{1, 20000, 2}}}
+};
+
+const auto nmsParamsManyAnchors = ::testing::Combine(::testing::ValuesIn(inShapeParamsManyAnchors),
+                                                     ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                        ::testing::Values(ElementType::i32),
+                                                                        ::testing::Values(ElementType::f32)),
+                                                     ::testing::Values(100, 1000),
+                                                     ::testing::Combine(::testing::Values(0.5f),
+                                                                        ::testing::Values(0.3f),
+                                                                        ::testing::Values(0.0f)),
+                                                     ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                                     ::testing::Values(op::v9::NonMaxSuppression::BoxEncodingType::CORNER),
+                                                     ::testing::ValuesIn(sortResDesc),
+                                                     ::testing::Values(element::i32),
+                                                     ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_ManyAnchors, NmsLayerCPUTest, nmsParamsManyAnchors, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
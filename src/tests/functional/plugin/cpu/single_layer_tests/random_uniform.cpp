@@ -0,0 +1,143 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+using RandomUniformCPUTestParams = std::tuple<
+        ov::Shape,                    // output shape
+        ElementType,                  // output precision
+        std::pair<double, double>,    // min and max values
+        int64_t,                      // global seed
+        int64_t>;                     // op seed
+
+class RandomUniformLayerCPUTest : public testing::WithParamInterface<RandomUniformCPUTestParams>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RandomUniformCPUTestParams>& obj) {
+        ov::Shape outputShape;
+        ElementType outType;
+        std::pair<double, double> range;
+        int64_t globalSeed, opSeed;
+        std::tie(outputShape, outType, range, globalSeed, opSeed) = obj.param;
+        std::ostringstream result;
+        result << "OS=" << CommonTestUtils::vec2str(outputShape) << "_";
+        result << "Prc=" << outType << "_";
+        result << "Min=" << range.first << "_Max=" << range.second << "_";
+        result << "GlobalSeed=" << globalSeed << "_OpSeed=" << opSeed;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ov::Shape outputShape;
+        std::pair<double, double> range;
+        int64_t globalSeed, opSeed;
+        std::tie(outputShape, outType, range, globalSeed, opSeed) = GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the bf16 output is checked bit exact, so the plugin must not change the precision of the graph
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+
+        auto shapeConst = ngraph::opset8::Constant::create(ov::element::i64, {outputShape.size()}, outputShape);
+        auto minConst = ngraph::opset8::Constant::create(outType, {1}, std::vector<double>{range.first});
+        auto maxConst = ngraph::opset8::Constant::create(outType, {1}, std::vector<double>{range.second});
+        auto randomUniform = std::make_shared<ngraph::opset8::RandomUniform>(shapeConst, minConst, maxConst, outType, globalSeed, opSeed);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ngraph::opset8::Result>(randomUniform)},
+                                               ov::ParameterVector{},
+                                               "RandomUniform");
+
+        // the separate instance keeps its own Philox state, which advances with every evaluation just like the plugin node
+        reference = std::make_shared<ngraph::opset8::RandomUniform>(shapeConst, minConst, maxConst, outType, globalSeed, opSeed);
+        for (auto&& constant : {shapeConst, minConst, maxConst}) {
+            referenceInputs.push_back(std::make_shared<ngraph::HostTensor>(constant));
+        }
+    }
+
+    std::vector<uint8_t> referenceNext() {
+        const auto& outputShape = function->get_output_shape(0);
+        auto output = std::make_shared<ngraph::HostTensor>(outType, outputShape);
+        EXPECT_TRUE(reference->evaluate({output}, referenceInputs));
+        const auto data = output->get_data_ptr<uint8_t>();
+        return {data, data + output->get_size_in_bytes()};
+    }
+
+    std::shared_ptr<ngraph::opset8::RandomUniform> reference;
+    ngraph::HostTensorVector referenceInputs;
+};
+
+TEST_P(RandomUniformLayerCPUTest, RepeatedInferenceFollowsReferenceState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+
+    std::vector<uint8_t> previous;
+    for (size_t run = 0; run < 2; ++run) {
+        inferRequest.infer();
+        const auto actual = inferRequest.get_output_tensor(0);
+        ASSERT_EQ(outType, actual.get_element_type());
+        const auto expected = referenceNext();
+        ASSERT_EQ(expected.size(), actual.get_byte_size());
+        EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.size())) << "run " << run;
+        // every run continues the sequence rather than repeating it
+        if (run > 0) {
+            EXPECT_NE(previous, expected);
+        }
+        previous = expected;
+    }
+}
+
+TEST(RandomUniformLayerCPUTest, EqualRuntimeMinMaxAreRejected) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // the min and max values are the inputs, so they are checked only at runtime: the integer range must not be empty
+    auto shapeConst = ngraph::opset8::Constant::create(ov::element::i64, {2}, std::vector<int64_t>{2, 3});
+    auto minParam = std::make_shared<ngraph::opset8::Parameter>(ov::element::i32, ov::Shape{1});
+    auto maxParam = std::make_shared<ngraph::opset8::Parameter>(ov::element::i32, ov::Shape{1});
+    auto randomUniform = std::make_shared<ngraph::opset8::RandomUniform>(shapeConst, minParam, maxParam, ov::element::i32, 150, 10);
+    auto function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ngraph::opset8::Result>(randomUniform)},
+                                                ov::ParameterVector{minParam, maxParam},
+                                                "RandomUniform");
+
+    auto inferRequest = ov::Core().compile_model(function, CommonTestUtils::DEVICE_CPU).create_infer_request();
+    const int32_t bound = 5;
+    inferRequest.set_tensor(minParam, ov::Tensor(ov::element::i32, ov::Shape{1}, const_cast<int32_t*>(&bound)));
+    inferRequest.set_tensor(maxParam, ov::Tensor(ov::element::i32, ov::Shape{1}, const_cast<int32_t*>(&bound)));
+    EXPECT_THROW(inferRequest.infer(), ov::Exception);
+}
+
+namespace {
+
+const std::vector<ov::Shape> outputShapes = {
+        {1, 3, 3, 3},
+        {2, 1, 10, 10},
+        {3, 7, 17, 9},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_RandomUniform_Float, RandomUniformLayerCPUTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(outputShapes),
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(std::pair<double, double>{0.0, 1.0}, std::pair<double, double>{-5.0, 5.0}),
+                ::testing::Values(0, 150),
+                ::testing::Values(10, 50)),
+        RandomUniformLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_RandomUniform_Int, RandomUniformLayerCPUTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(outputShapes),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(std::pair<double, double>{-100.0, 50.0}),
+                ::testing::Values(0, 150),
+                ::testing::Values(10, 50)),
+        RandomUniformLayerCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -92,6 +92,54 @@ TEST_P(TensorIteratorCPUTest, CompareWithRefs) {
     run();
 }
 
+// The accumulator is passed to the next iteration over the back edge and concatenated at the same time,
+// so the back edge has to read the previous chunk of the output before the body output is bound to the next one.
+class TensorIteratorBackEdgeCPUTest : public TensorIteratorCPUTest {
+protected:
+    void SetUp() override {
+        std::vector<InputShape> shapes;
+        ngraph::op::RecurrentSequenceDirection direction;
+        ElementType inType;
+        std::tie(shapes, direction, inType) = this->GetParam();
+
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes({shapes});
+
+        const size_t sequence_axis = 1;
+        auto tensor_iterator = std::make_shared<ngraph::opset5::TensorIterator>();
+        auto params = ngraph::builder::makeDynamicParams(inType, inputDynamicShapes);
+
+        ngraph::PartialShape slice_shape = shapes[0].first;
+        slice_shape[sequence_axis] = 1;
+        auto xi = std::make_shared<ngraph::opset1::Parameter>(inType, slice_shape);
+        auto hi = std::make_shared<ngraph::opset1::Parameter>(inType, shapes[1].first);
+        auto add = std::make_shared<ngraph::opset1::Add>(xi, hi);
+
+        auto body = std::make_shared<ov::Model>(ngraph::OutputVector{add}, ngraph::ParameterVector{xi, hi}, "body");
+        tensor_iterator->set_function(body);
+
+        if (direction == ngraph::op::RecurrentSequenceDirection::FORWARD) {
+            tensor_iterator->set_sliced_input(xi, params[0], 0, 1, 1, -1, sequence_axis);
+            tensor_iterator->get_concatenated_slices(add, 0, 1, 1, -1, sequence_axis);
+        } else if (direction == ngraph::op::RecurrentSequenceDirection::REVERSE) {
+            tensor_iterator->set_sliced_input(xi, params[0], -1, -1, 1, 0, sequence_axis);
+            tensor_iterator->get_concatenated_slices(add, -1, -1, 1, 0, sequence_axis);
+        } else {
+            NGRAPH_CHECK(false, "Bidirectional case is not supported.");
+        }
+        tensor_iterator->set_merged_input(hi, params[1], add);
+        auto last = tensor_iterator->get_iter_value(add, -1);
+
+        function = std::make_shared<ov::Model>(ngraph::OutputVector{tensor_iterator->output(0), last}, params);
+    }
+};
+
+TEST_P(TensorIteratorBackEdgeCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
 namespace {
 
 const std::vector<ElementType> inputPrecisions = {
@@ -153,5 +201,32 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// the slices along the axis are dense when the outer dims are 1, so they may be passed to the body without copies
+std::vector<std::vector<InputShape>> staticInputs = {
+    {{{}, {{1, 12, 10}}}, {{}, {{1, 12, 10}}}},
+    {{{}, {{1, 5, 1}}}, {{}, {{1, 5, 1}}}},
+    {{{}, {{5, 5, 5}}}, {{}, {{5, 5, 5}}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic, TensorIteratorCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(staticInputs),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
+// the accumulator shape is the slice shape
+std::vector<std::vector<InputShape>> backEdgeInputs = {
+    {{{}, {{1, 12, 10}}}, {{}, {{1, 1, 10}}}},
+    {{{}, {{1, 5, 1}}}, {{}, {{1, 1, 1}}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStaticBackEdge, TensorIteratorBackEdgeCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(backEdgeInputs),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::Values(ElementType::f32, ElementType::bf16)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
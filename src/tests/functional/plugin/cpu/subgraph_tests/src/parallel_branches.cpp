@@ -0,0 +1,83 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (Inception-like block):
+/*
+ *                        Parameter
+ *               /        /      \          \
+ *         Conv1x1    Conv1x1   Conv1x1    MaxPool
+ *            |          |         |          |
+ *            |       Conv3x3   Conv3x3    Conv1x1
+ *            |          |         |          |
+ *            |          |      Conv3x3       |
+ *             \         |         |         /
+ *                        Concat
+ *                          |
+ *                     Add (Parameter)
+ *                          |
+ *                        Result
+ */
+
+class ParallelBranchesTest : public testing::WithParamInterface<bool>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        std::ostringstream result;
+        result << "parallelBranches=" << (obj.param ? "True" : "False");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::parallel_branches(GetParam()));
+
+        const ov::Shape inputShape = {1, 16, 14, 14};
+        const ov::Shape concatShape = {1, 64, 14, 14};
+        init_input_shapes(static_shapes_to_test_representation({inputShape, concatShape}));
+
+        const auto prc = ov::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(prc, inputDynamicShapes);
+
+        auto makeConv = [&](const ov::Output<ov::Node>& in, size_t kernel) {
+            const ptrdiff_t pad = kernel / 2;
+            return ngraph::builder::makeConvolution(in, prc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                                    ngraph::op::PadType::EXPLICIT, 16, true);
+        };
+
+        auto branch1 = makeConv(params[0], 1);
+        auto branch2 = makeConv(makeConv(params[0], 1), 3);
+        auto branch3 = makeConv(makeConv(makeConv(params[0], 1), 3), 3);
+        auto pool = ngraph::builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto branch4 = makeConv(pool, 1);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch1, branch2, branch3, branch4}, 1);
+        auto add = std::make_shared<ov::op::v1::Add>(concat, params[1]);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{add}, params, "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches, ParallelBranchesTest,
+                         ::testing::Values(true, false),
+                         ParallelBranchesTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,62 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter   Parameter
+ *       |           |
+ *    MatMul <-------+
+ *       |
+ *    Softmax
+ *       |
+ *     Result
+ */
+
+class ShapeBucketsTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the last shape is not in the buckets and is compiled on the fly
+        configuration.insert(ov::intel_cpu::shape_buckets("data:1x32x64,weights:1x64x32;data:1x128x64,weights:1x64x128"));
+
+        init_input_shapes({InputShape{{1, {1, 256}, 64}, {{1, 32, 64}, {1, 128, 64}, {1, 48, 64}}},
+                           InputShape{{1, 64, {1, 256}}, {{1, 64, 32}, {1, 64, 128}, {1, 64, 48}}}});
+
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        params[0]->set_friendly_name("data");
+        params[1]->set_friendly_name("weights");
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], params[1]);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(matMul, 2);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{softmax}, params, "ShapeBuckets");
+    }
+};
+
+TEST_F(ShapeBucketsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+TEST_F(ShapeBucketsTest, IncompatibleBucketsAreRejected) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    for (const auto& buckets : {"data:1x512x64,weights:1x64x32",    // out of the dimension range
+                                "data:1x32,weights:1x64x32",        // wrong rank
+                                "data:2x32x64,weights:1x64x32",     // static dimension mismatch
+                                "data:1x32x64"}) {                  // dynamic input without the shape
+        configuration[ov::intel_cpu::shape_buckets.name()] = buckets;
+        EXPECT_THROW(core->compile_model(function, targetDevice, configuration), ov::Exception) << buckets;
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,91 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ie_system_conf.h>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (Softmax denominator-like pattern):
+/*
+ *        Parameter    Parameter
+ *           |            |
+ *          Sinh         Sinh
+ *             \        /
+ *                Add
+ *                 |
+ *                Exp
+ *                 |
+ *      ReduceSum/ReduceMax (axis = -1, keep_dims)
+ *                 |
+ *               Result
+ */
+// Sinh is not supported by snippets, it separates the eltwise chain from the inputs
+// (eltwises right after the inputs are not tokenized by the CPU plugin)
+
+using SnippetsReduceParams = std::tuple<ov::Shape, ngraph::helpers::ReductionType>;
+
+class SnippetsReduceTest : public testing::WithParamInterface<SnippetsReduceParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsReduceParams>& obj) {
+        ov::Shape inputShape;
+        ngraph::helpers::ReductionType reductionType;
+        std::tie(inputShape, reductionType) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "type=" << reductionType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::Shape inputShape;
+        ngraph::helpers::ReductionType reductionType;
+        std::tie(inputShape, reductionType) = GetParam();
+        init_input_shapes(static_shapes_to_test_representation({inputShape, inputShape}));
+
+        const auto prc = ov::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(prc, inputDynamicShapes);
+        auto sinh0 = std::make_shared<ov::op::v0::Sinh>(params[0]);
+        auto sinh1 = std::make_shared<ov::op::v0::Sinh>(params[1]);
+        auto add = std::make_shared<ov::op::v1::Add>(sinh0, sinh1);
+        auto exp = std::make_shared<ov::op::v0::Exp>(add);
+        auto reduce = ngraph::builder::makeReduce(exp, ov::op::v0::Constant::create(ov::element::i64, {1}, {-1}), true, reductionType);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{reduce}, params, "SnippetsReduce");
+    }
+};
+
+TEST_P(SnippetsReduceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        // Add, Exp and the reduction are executed by a single snippet
+        CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+        CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Reduce", 0);
+    }
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {1, 4, 10, 37},     // vector + scalar tiles
+    {2, 3, 16},         // vector tile only
+    {1, 2, 5, 3},       // scalar tile only
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsReduce, SnippetsReduceTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ngraph::helpers::ReductionType::Sum,
+                                                              ngraph::helpers::ReductionType::Max)),
+                         SnippetsReduceTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -6,11 +6,14 @@
 #include <utility>
 #include <vector>
 #include <memory>
+#include <thread>
+#include <chrono>
 
 #include <gpu/gpu_config.hpp>
 #include <common_test_utils/test_common.hpp>
 #include <functional_test_utils/plugin_cache.hpp>
 
+#include "ngraph/opsets/opset8.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include "functional_test_utils/blob_utils.hpp"
 #include "base/behavior_test_utils.hpp"
@@ -49,6 +52,7 @@ protected:
     size_t num_streams;
     size_t num_requests;
     size_t num_batch;
+    bool partial_batches = false;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
 
     void TestAutoBatch() {
@@ -78,6 +82,8 @@ protected:
             }
             // minimize timeout to reduce test time
             config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            if (partial_batches)
+                config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(YES);
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     target_device + "(" + std::to_string(num_batch) + ")",
                                                config);
@@ -160,6 +166,171 @@ public:
     }
 };
 
+// the requests flushed by the (minimal) timeout are executed with the ladder of the partial batches
+class AutoBatching_Test_PartialBatches : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        std::tie(target_device, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptrs = {ngraph::builder::subgraph::makeSingleConv(),
+                   ngraph::builder::subgraph::makeMultiSingleConv()};
+        partial_batches = true;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "PartialBatches_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
+// the network multiplies the input by its own batch size, so the outputs tell which batch was executed
+class AutoBatching_Test_PartialBatchLadder : public BehaviorTestsUtils::IEPluginTestBase,
+                                             public testing::WithParamInterface<std::string> {
+    void SetUp() override {
+        target_device = this->GetParam();
+        auto param = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        auto shape = std::make_shared<ngraph::opset8::ShapeOf>(param);
+        auto batch = std::make_shared<ngraph::opset8::Gather>(
+                shape,
+                ngraph::opset8::Constant::create(ngraph::element::i64, {}, {0}),
+                ngraph::opset8::Constant::create(ngraph::element::i64, {}, {0}));
+        auto scale = std::make_shared<ngraph::opset8::Convert>(batch, ngraph::element::f32);
+        auto mul = std::make_shared<ngraph::opset8::Multiply>(param, scale);
+        auto result = std::make_shared<ngraph::opset8::Result>(mul);
+        fn_ptr = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+    };
+
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::string> &obj) {
+        return obj.param;
+    }
+
+protected:
+    std::shared_ptr<ngraph::Function> fn_ptr;
+
+    // the requests are started together, so (with the long timeout) all of them are collected within a single timeout
+    void TestExecutedBatch(bool partial_batches, size_t num_requests, size_t num_batch, float expected_batch) {
+        CNNNetwork net(fn_ptr);
+        std::map<std::string, std::string> config;
+        config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1000);
+        config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = partial_batches ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+        auto ie = InferenceEngine::Core();
+        auto exec_net = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                            target_device + "(" + std::to_string(num_batch) + ")",
+                                       config);
+        const auto input = net.getInputsInfo().begin()->first;
+        const auto output = net.getOutputsInfo().begin()->first;
+        std::vector<InferRequest> irs;
+        for (size_t i = 0; i < num_requests; i++) {
+            irs.push_back(exec_net.CreateInferRequest());
+            auto data = irs.back().GetBlob(input)->buffer().as<float*>();
+            std::fill_n(data, 16, static_cast<float>(i + 1));
+        }
+        for (auto& ir : irs)
+            ir.StartAsync();
+        for (auto& ir : irs)
+            ir.Wait(InferRequest::RESULT_READY);
+        for (size_t i = 0; i < num_requests; i++) {
+            const auto data = irs[i].GetBlob(output)->cbuffer().as<const float*>();
+            for (size_t j = 0; j < 16; j++)
+                ASSERT_EQ(static_cast<float>(i + 1) * expected_batch, data[j]) << "request " << i;
+        }
+    }
+};
+
+// the adaptive (latency SLO driven) timeout and the batch fill metrics
+class AutoBatching_Test_AdaptiveTimeout : public BehaviorTestsUtils::IEPluginTestBase,
+                                          public testing::WithParamInterface<std::string> {
+    void SetUp() override {
+        target_device = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeSingleConv();
+    };
+
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::string> &obj) {
+        return obj.param;
+    }
+
+protected:
+    std::shared_ptr<ngraph::Function> fn_ptr;
+    const size_t num_batch = 8;
+
+    ExecutableNetwork LoadNetwork(InferenceEngine::Core& ie, const std::map<std::string, std::string>& config) {
+        return ie.LoadNetwork(CNNNetwork(fn_ptr),
+                              std::string(CommonTestUtils::DEVICE_BATCH) + ":" + target_device + "(" +
+                              std::to_string(num_batch) + ")",
+                              config);
+    }
+};
+
+TEST_P(AutoBatching_Test_AdaptiveTimeout, effectiveTimeoutAdaptsToRareRequests) {
+    auto ie = InferenceEngine::Core();
+    auto exec_net = LoadNetwork(ie, {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), "1000"},
+                                     {CONFIG_KEY(AUTO_BATCH_LATENCY_SLO), "100"}});
+    auto req = exec_net.CreateInferRequest();
+    // the requests arrive (one at a time) less often than the SLO, so the batch is never filled within it
+    const int niter = 4;
+    for (int i = 0; i < niter; i++) {
+        req.Infer();
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    }
+    // no waiting for the rest of the batch, as the next request is not expected within the SLO
+    EXPECT_EQ(1u, exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT)).as<unsigned int>());
+    // each collected batch had a single request
+    EXPECT_FLOAT_EQ(1.f / num_batch, exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_FILL)).as<float>());
+
+    // without the SLO, the timeout is fixed
+    exec_net.SetConfig({{CONFIG_KEY(AUTO_BATCH_LATENCY_SLO), "0"}});
+    EXPECT_EQ(1000u, exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT)).as<unsigned int>());
+}
+
+TEST_P(AutoBatching_Test_AdaptiveTimeout, effectiveTimeoutIsLimitedBySLO) {
+    auto ie = InferenceEngine::Core();
+    auto exec_net = LoadNetwork(ie, {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), "1000"},
+                                     {CONFIG_KEY(AUTO_BATCH_LATENCY_SLO), "100"}});
+    // the partially filled batch is executed once the timeout (chosen within the SLO) is over
+    std::vector<InferRequest> irs;
+    for (size_t i = 0; i < num_batch / 2; i++)
+        irs.push_back(exec_net.CreateInferRequest());
+    for (auto& ir : irs)
+        ir.StartAsync();
+    for (auto& ir : irs)
+        ASSERT_EQ(StatusCode::OK, ir.Wait(InferRequest::RESULT_READY));
+    const auto timeOut = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT)).as<unsigned int>();
+    EXPECT_GE(timeOut, 1u);
+    EXPECT_LE(timeOut, 100u);
+    const auto fill = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_FILL)).as<float>();
+    EXPECT_GT(fill, 0.f);
+    EXPECT_LE(fill, 0.5f);
+}
+
+TEST_P(AutoBatching_Test_AdaptiveTimeout, fullBatchesReportFullFill) {
+    auto ie = InferenceEngine::Core();
+    auto exec_net = LoadNetwork(ie, {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), "1000"}});
+    EXPECT_FLOAT_EQ(0.f, exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_FILL)).as<float>());
+    std::vector<InferRequest> irs;
+    for (size_t i = 0; i < num_batch; i++)
+        irs.push_back(exec_net.CreateInferRequest());
+    for (auto& ir : irs)
+        ir.StartAsync();
+    for (auto& ir : irs)
+        ASSERT_EQ(StatusCode::OK, ir.Wait(InferRequest::RESULT_READY));
+    EXPECT_FLOAT_EQ(1.f, exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_FILL)).as<float>());
+    // the timeout is not adaptive without the SLO
+    EXPECT_EQ(1000u, exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_TIMEOUT)).as<unsigned int>());
+}
+
+TEST_P(AutoBatching_Test_PartialBatchLadder, partialBatchRunsOnNextLargerLadderNetwork) {
+    TestExecutedBatch(true, 3, 8, 4.f);
+    TestExecutedBatch(true, 5, 8, 8.f);
+}
+
+TEST_P(AutoBatching_Test_PartialBatchLadder, partialBatchRunsWithBatch1ByDefault) {
+    TestExecutedBatch(false, 3, 8, 1.f);
+}
+
+TEST_P(AutoBatching_Test_PartialBatchLadder, fullBatchRunsOnBatchedNetwork) {
+    TestExecutedBatch(true, 8, 8, 8.f);
+}
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -168,4 +339,8 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_PartialBatches, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
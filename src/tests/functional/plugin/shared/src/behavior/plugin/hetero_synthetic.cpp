@@ -11,6 +11,7 @@
 #include "openvino/util/file_util.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include "hetero/hetero_plugin_config.hpp"
 
 namespace HeteroTests {
 
@@ -193,4 +194,58 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedRequestsInFlightMatchReference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE)] = InferenceEngine::PluginConfigParams::YES;
+    functionRefs = ngraph::clone_function(*function);
+    LoadNetwork();
+    // several requests (with different inputs) are in flight, so the subgraphs (stages) execute them concurrently
+    const int numRequests = 4;
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<std::vector<InferenceEngine::Blob::Ptr>> requestsInputs;
+    for (int r = 0; r < numRequests; ++r) {
+        inputs.clear();
+        for (auto&& param : function->get_parameters()) {
+            const auto info = executableNetwork.GetInputsInfo().at(param->get_friendly_name());
+            inputs.push_back(FuncTestUtils::createAndFillBlob(info->getTensorDesc(), 10, 0, 1, r + 1));
+        }
+        inferRequest = executableNetwork.CreateInferRequest();
+        ConfigureInferRequest();
+        requests.push_back(inferRequest);
+        requestsInputs.push_back(inputs);
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+    }
+    for (int r = 0; r < numRequests; ++r) {
+        SCOPED_TRACE("request " + std::to_string(r));
+        inputs = requestsInputs[r];
+        inferRequest = requests[r];
+        Validate();
+    }
+}
+
+TEST_P(HeteroSyntheticTest, costBasedPartitioningMatchesReference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // no explicit affinities, the nodes are assigned by the cost-based partitioning of the query
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    configuration[HETERO_CONFIG_KEY(COST_BASED_PARTITIONING)] = InferenceEngine::PluginConfigParams::YES;
+    Run();
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    auto queryResult = core->QueryNetwork(InferenceEngine::CNNNetwork{function}, targetDevice, configuration);
+    // both devices support all the nodes, so the transfers are avoided by keeping the network on the first device
+    for (auto&& node : function->get_ordered_ops()) {
+        auto itAffinity = queryResult.supportedLayersMap.find(node->get_friendly_name());
+        ASSERT_NE(queryResult.supportedLayersMap.end(), itAffinity) << node->get_friendly_name();
+        EXPECT_EQ(pluginParameters.at(0)._name, itAffinity->second) << node->get_friendly_name();
+    }
+}
+
 }  //  namespace HeteroTests
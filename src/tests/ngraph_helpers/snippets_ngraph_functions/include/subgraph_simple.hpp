@@ -125,6 +125,23 @@ protected:
     std::shared_ptr<ov::Model> initOriginal() const override;
     std::shared_ptr<ov::Model> initReference() const override;
 };
+/// Eltwise chain finished with ReduceSum along the innermost axis and followed by Sqrt.
+/// The reduction is attached to the Add+Exp subgraph, but it terminates the subgraph, so Sqrt starts a new one.
+//     in1   in2
+//        Add
+//        Exp
+//     ReduceSum
+//       Sqrt
+//      Result
+class EltwiseReduceFunction : public SnippetsFunctionBase {
+public:
+    explicit EltwiseReduceFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+            NGRAPH_CHECK(input_shapes.size() == 2, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+};
 
 }  // namespace snippets
 }  // namespace test
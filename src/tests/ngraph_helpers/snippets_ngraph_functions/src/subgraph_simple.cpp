@@ -186,6 +186,33 @@ std::shared_ptr<ov::Model> EltwiseLogLoopFunction::initReference() const {
                                                                   ParameterVector{subgraph_param, log_param}));
     return std::make_shared<Model>(NodeVector{mul}, ParameterVector{data0, data1});
 }
+std::shared_ptr<ov::Model> EltwiseReduceFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto add = std::make_shared<op::v1::Add>(data0, data1);
+    auto exp = std::make_shared<op::v0::Exp>(add);
+    auto axes = std::make_shared<op::v0::Constant>(element::i64, Shape{1}, std::vector<int64_t>{-1});
+    auto reduce = std::make_shared<op::v1::ReduceSum>(exp, axes, true);
+    auto sqrt = std::make_shared<op::v0::Sqrt>(reduce);
+    return std::make_shared<Model>(NodeVector{sqrt}, ParameterVector{data0, data1});
+}
+std::shared_ptr<ov::Model> EltwiseReduceFunction::initReference() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto indata0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto indata1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto inAdd = std::make_shared<op::v1::Add>(indata0, indata1);
+    auto inExp = std::make_shared<op::v0::Exp>(inAdd);
+    auto axes = std::make_shared<op::v0::Constant>(element::i64, Shape{1}, std::vector<int64_t>{-1});
+    auto inReduce = std::make_shared<op::v1::ReduceSum>(inExp, axes, true);
+    auto reduce = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{data0, data1},
+                                          std::make_shared<Model>(NodeVector{inReduce}, ParameterVector{indata0, indata1}));
+    auto reduce_param = std::make_shared<op::v0::Parameter>(precision, reduce->get_output_shape(0));
+    auto sqrt = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{reduce},
+                                          std::make_shared<Model>(NodeVector{std::make_shared<op::v0::Sqrt>(reduce_param)},
+                                                                  ParameterVector{reduce_param}));
+    return std::make_shared<Model>(NodeVector{sqrt}, ParameterVector{data0, data1});
+}
 
 }  // namespace snippets
 }  // namespace test
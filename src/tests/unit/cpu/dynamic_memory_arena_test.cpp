@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <dynamic_memory_arena.h>
+
+using namespace ov::intel_cpu;
+
+TEST(DynamicMemoryArenaTest, NoReallocationInSteadyState) {
+    DynamicMemoryArena arena;
+    auto first = arena.addGroup(0, 1);
+    auto second = arena.addGroup(1, 2);
+    auto third = arena.addGroup(3, 4);
+
+    // the first inference: the sizes are unknown, so the groups are allocated individually
+    ASSERT_TRUE(first->resize(1000));
+    ASSERT_TRUE(second->resize(2000));
+    ASSERT_TRUE(third->resize(500));
+    ASSERT_FALSE(first->hasExtBuffer());
+
+    ASSERT_TRUE(arena.update());
+    // the first and the second groups overlap in time, while the third one reuses their memory
+    ASSERT_EQ(arena.getSize(), size_t(3072));
+    auto base = static_cast<uint8_t*>(first->getRawPtr()) < static_cast<uint8_t*>(second->getRawPtr()) ?
+                static_cast<uint8_t*>(first->getRawPtr()) : static_cast<uint8_t*>(second->getRawPtr());
+    ASSERT_EQ(third->getRawPtr(), base);
+
+    // smaller and the same sizes fit into the arena
+    ASSERT_FALSE(first->resize(500));
+    ASSERT_FALSE(second->resize(2000));
+    ASSERT_FALSE(third->resize(100));
+    ASSERT_FALSE(arena.update());
+
+    // a bigger size leads to the individual allocation within the inference and to the new layout after it
+    ASSERT_TRUE(third->resize(4000));
+    ASSERT_TRUE(arena.update());
+    ASSERT_EQ(arena.getSize(), size_t(4032));
+    ASSERT_FALSE(third->resize(4000));
+    ASSERT_FALSE(arena.update());
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+#include <nodes/input.h>
+#include <weights_cache.hpp>
+
+#include <cstdio>
+#include <dnnl.hpp>
+#include <fstream>
+#include <limits>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <openvino/util/mmap_object.hpp>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+class InputNodeConstantTest : public ::testing::Test {
+protected:
+    const std::string m_fileName = ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+                                   std::string("_weights.bin");
+    std::vector<float> m_values = std::vector<float>(256);
+    std::shared_ptr<ov::util::MappedMemory> m_mapped;
+
+    void SetUp() override {
+        for (size_t i = 0; i < m_values.size(); ++i) {
+            m_values[i] = static_cast<float>(i) + 1.f;
+        }
+        {
+            std::ofstream file(m_fileName, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(m_values.data()), m_values.size() * sizeof(float));
+        }
+        m_mapped = ov::util::load_mmap_object(m_fileName);
+    }
+
+    void TearDown() override {
+        m_mapped.reset();
+        std::remove(m_fileName.c_str());
+    }
+
+    // the constant refers to the memory mapped from the weights file, like the constants of a model read from IR
+    std::shared_ptr<ngraph::Node> makeMappedConstant() const {
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            m_mapped->data(), m_mapped->size(), m_mapped);
+        return std::make_shared<ngraph::opset8::Constant>(ngraph::element::f32, ngraph::Shape{m_values.size()}, buffer);
+    }
+
+    static void checkData(const MemoryCPtr& memory, const std::vector<float>& values) {
+        const auto data = static_cast<const float*>(memory->GetData());
+        ASSERT_EQ(values, std::vector<float>(data, data + values.size()));
+    }
+};
+}  // namespace
+
+TEST_F(InputNodeConstantTest, WeightsCacheSharesMappedMemoryOnSingleNumaNode) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto weightsCache = std::make_shared<WeightsSharing>();
+    const auto constant = makeMappedConstant();
+    node::Input input(constant, eng, weightsCache);
+
+    const auto memory = input.getMemoryPtr();
+    ASSERT_NE(nullptr, memory);
+    checkData(memory, m_values);
+    if (InferenceEngine::getAvailableNUMANodes().size() < 2) {
+        // no copy: the node memory aliases the mapped region
+        ASSERT_EQ(static_cast<const void*>(m_mapped->data()), memory->GetData());
+    } else {
+        // the weights are copied to the local memory of the NUMA node
+        ASSERT_NE(static_cast<const void*>(m_mapped->data()), memory->GetData());
+    }
+}
+
+TEST_F(InputNodeConstantTest, SharesMappedMemoryWithoutWeightsCache) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing::Ptr weightsCache;
+    const auto constant = makeMappedConstant();
+    node::Input input(constant, eng, weightsCache);
+
+    const auto memory = input.getMemoryPtr();
+    ASSERT_NE(nullptr, memory);
+    checkData(memory, m_values);
+    ASSERT_EQ(static_cast<const void*>(m_mapped->data()), memory->GetData());
+}
+
+TEST_F(InputNodeConstantTest, CopiesConstantWithSubnormals) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto weightsCache = std::make_shared<WeightsSharing>();
+    std::vector<float> values(m_values.size(), 1.f);
+    values[1] = std::numeric_limits<float>::denorm_min();
+    const auto constant = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{values.size()}, values);
+    node::Input input(constant, eng, weightsCache);
+
+    const auto memory = input.getMemoryPtr();
+    ASSERT_NE(nullptr, memory);
+    // the constants with subnormals are always copied
+    ASSERT_NE(constant->get_data_ptr(), memory->GetData());
+}
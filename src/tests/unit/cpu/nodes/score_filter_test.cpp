@@ -0,0 +1,122 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common/score_filter.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+using Candidate = std::pair<float, int>;
+
+// the NMS family order: the higher score first, the lower index first on ties
+bool scoreThenIndex(const Candidate& l, const Candidate& r) {
+    return l.first > r.first || (l.first == r.first && l.second < r.second);
+}
+
+// few distinct scores, so most of the candidates are tied
+std::vector<Candidate> makeTiedCandidates(size_t count, int distinctScores, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, distinctScores - 1);
+    std::vector<Candidate> candidates(count);
+    for (size_t i = 0; i < count; i++) {
+        candidates[i] = {static_cast<float>(dist(gen)) / distinctScores, static_cast<int>(i)};
+    }
+    std::shuffle(candidates.begin(), candidates.end(), gen);
+    return candidates;
+}
+
+std::vector<Candidate> sortedCopy(std::vector<Candidate> candidates) {
+    std::sort(candidates.begin(), candidates.end(), scoreThenIndex);
+    return candidates;
+}
+
+}  // namespace
+
+TEST(ScoreFilterTest, FilterScoresKeepsOrderAndThreshold) {
+    const std::vector<float> scores = {0.1f, 0.5f, 0.7f, 0.5f, 0.0f, 0.9f};
+    std::vector<int> indices(scores.size());
+    ASSERT_EQ(2u, filterScores(scores.data(), scores.size(), 0.5f, false, indices.data()));
+    EXPECT_EQ(std::vector<int>({2, 5}), std::vector<int>(indices.begin(), indices.begin() + 2));
+    ASSERT_EQ(4u, filterScores(scores.data(), scores.size(), 0.5f, true, indices.data()));
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 5}), std::vector<int>(indices.begin(), indices.begin() + 4));
+
+    std::vector<Candidate> candidates(scores.size());
+    ASSERT_EQ(4u, filterScores(scores.data(), scores.size(), 0.5f, true, candidates.data()));
+    EXPECT_EQ(std::vector<Candidate>({{0.5f, 1}, {0.7f, 2}, {0.5f, 3}, {0.9f, 5}}),
+              std::vector<Candidate>(candidates.begin(), candidates.begin() + 4));
+    EXPECT_EQ(0u, filterScores(scores.data(), scores.size(), 1.0f, true, candidates.data()));
+}
+
+TEST(ScoreFilterTest, SortTopKBreaksTiesByIndex) {
+    const auto candidates = makeTiedCandidates(1000, 3, 1);
+    const auto expected = sortedCopy(candidates);
+    for (size_t k : {1u, 7u, 333u, 999u}) {
+        auto actual = candidates;
+        sortTopK(actual.begin(), actual.end(), k, scoreThenIndex);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + k, actual.begin())) << "k = " << k;
+        // the rest are the same candidates left unordered
+        std::sort(actual.begin() + k, actual.end(), scoreThenIndex);
+        EXPECT_TRUE(std::equal(expected.begin() + k, expected.end(), actual.begin() + k)) << "k = " << k;
+    }
+}
+
+TEST(ScoreFilterTest, SortTopKSortsAllWhenKExceedsCount) {
+    const auto candidates = makeTiedCandidates(100, 5, 2);
+    for (size_t k : {100u, 101u, 10000u}) {
+        auto actual = candidates;
+        sortTopK(actual.begin(), actual.end(), k, scoreThenIndex);
+        EXPECT_EQ(sortedCopy(candidates), actual) << "k = " << k;
+    }
+}
+
+TEST(ScoreFilterTest, SortTopKWithZeroKKeepsCandidates) {
+    const auto candidates = makeTiedCandidates(100, 5, 3);
+    auto actual = candidates;
+    sortTopK(actual.begin(), actual.end(), 0, scoreThenIndex);
+    EXPECT_EQ(sortedCopy(candidates), sortedCopy(actual));
+
+    std::vector<Candidate> empty;
+    sortTopK(empty.begin(), empty.end(), 0, scoreThenIndex);
+    sortTopK(empty.begin(), empty.end(), 10, scoreThenIndex);
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(ScoreFilterTest, LazySortedCandidatesMatchFullSort) {
+    const auto candidates = makeTiedCandidates(5000, 4, 4);
+    const auto expected = sortedCopy(candidates);
+    // the zero chunk is rounded up to one, so the chunks grow 1, 2, 4, ... until the tail is reached
+    for (size_t firstChunk : {0u, 1u, 3u, 64u, 5000u, 10000u}) {
+        auto actual = candidates;
+        auto lazy = makeLazySortedCandidates(actual, firstChunk, scoreThenIndex);
+        ASSERT_EQ(expected.size(), lazy.size());
+        for (size_t i = 0; i < lazy.size(); i++) {
+            ASSERT_EQ(expected[i], lazy[i]) << "firstChunk = " << firstChunk << ", i = " << i;
+        }
+    }
+}
+
+TEST(ScoreFilterTest, LazySortedCandidatesSortOnlyVisitedChunks) {
+    const auto candidates = makeTiedCandidates(1000, 2, 5);
+    const auto expected = sortedCopy(candidates);
+    auto actual = candidates;
+    auto lazy = makeLazySortedCandidates(actual, 10, scoreThenIndex);
+    EXPECT_EQ(expected[0], lazy[0]);
+    // only the first chunk is ordered, the tail still holds the rest of the candidates
+    EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + 10, actual.begin()));
+    EXPECT_EQ(sortedCopy(candidates), sortedCopy(actual));
+
+    // the jump sorts the next chunk of 20 candidates on the way
+    EXPECT_EQ(expected[25], lazy[25]);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + 30, actual.begin()));
+    EXPECT_EQ(expected.back(), lazy[lazy.size() - 1]);
+    EXPECT_EQ(expected, actual);
+}
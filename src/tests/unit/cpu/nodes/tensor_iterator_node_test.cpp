@@ -0,0 +1,74 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+#include <graph.h>
+#include <nodes/tensoriterator.h>
+#include <weights_cache.hpp>
+
+#include <ngraph/opsets/opset5.hpp>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// X[1, 4, 3] is sliced along the axis 1, the accumulator H[1, 1, 3] is passed over the back edge,
+// the optional Y of the X shape is sliced and concatenated back as is
+std::shared_ptr<ov::Model> makeAccumulation(bool passThroughInput) {
+    const ov::Shape fullShape{1, 4, 3}, sliceShape{1, 1, 3};
+    auto x = std::make_shared<ngraph::opset5::Parameter>(ov::element::f32, fullShape);
+    auto h = std::make_shared<ngraph::opset5::Parameter>(ov::element::f32, sliceShape);
+    auto y = std::make_shared<ngraph::opset5::Parameter>(ov::element::f32, fullShape);
+
+    auto xi = std::make_shared<ngraph::opset5::Parameter>(ov::element::f32, sliceShape);
+    auto hi = std::make_shared<ngraph::opset5::Parameter>(ov::element::f32, sliceShape);
+    auto yi = std::make_shared<ngraph::opset5::Parameter>(ov::element::f32, sliceShape);
+    auto add = std::make_shared<ngraph::opset5::Add>(xi, hi);
+    ov::OutputVector bodyOutputs{add};
+    ov::ParameterVector bodyParams{xi, hi};
+    if (passThroughInput) {
+        bodyOutputs.push_back(yi);
+        bodyParams.push_back(yi);
+    }
+    auto body = std::make_shared<ov::Model>(bodyOutputs, bodyParams);
+
+    auto tensorIterator = std::make_shared<ngraph::opset5::TensorIterator>();
+    tensorIterator->set_function(body);
+    tensorIterator->set_sliced_input(xi, x, 0, 1, 1, -1, 1);
+    tensorIterator->set_merged_input(hi, h, add);
+    ov::OutputVector outputs{tensorIterator->get_concatenated_slices(add, 0, 1, 1, -1, 1),
+                             tensorIterator->get_iter_value(add, -1)};
+    ov::ParameterVector params{x, h};
+    if (passThroughInput) {
+        tensorIterator->set_sliced_input(yi, y, 0, 1, 1, -1, 1);
+        outputs.push_back(tensorIterator->get_concatenated_slices(yi, 0, 1, 1, -1, 1));
+        params.push_back(y);
+    }
+    return std::make_shared<ov::Model>(outputs, params);
+}
+
+size_t boundPortsCount(const std::shared_ptr<ov::Model>& model) {
+    const std::shared_ptr<const ov::Model> net = model;
+    auto extensionManager = std::make_shared<ExtensionManager>();
+    auto cache = std::make_shared<WeightsSharing>();
+    Graph graph;
+    graph.CreateGraph(net, extensionManager, cache);
+    for (const auto& node : graph.GetNodes()) {
+        if (auto tensorIterator = std::dynamic_pointer_cast<node::TensorIterator>(node))
+            return tensorIterator->getBoundPortsCount();
+    }
+    ADD_FAILURE() << "The graph has no TensorIterator node";
+    return 0;
+}
+
+}  // namespace
+
+TEST(TensorIteratorNodeTest, BindsSlicedPortsOfPlainTensors) {
+    // the sliced input and the concatenated output, the last value goes over the back edge
+    EXPECT_EQ(2u, boundPortsCount(makeAccumulation(false)));
+}
+
+TEST(TensorIteratorNodeTest, DoesNotBindOutputPassedThroughFromInput) {
+    // Y is bound as the input, but its output shares the memory with the input, so it is copied
+    EXPECT_EQ(3u, boundPortsCount(makeAccumulation(true)));
+}
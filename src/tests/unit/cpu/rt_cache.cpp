@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +380,112 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, GetPut) {
+    constexpr size_t capacity = 1024;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), size_t(0));
+}
+
+TEST(ShardedLruCacheTests, Evict) {
+    constexpr size_t capacity = 1024;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), capacity);
+
+    ASSERT_NO_THROW(cache.evict(2 * capacity));
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), 2 * capacity);
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr size_t attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.misses, 4 * capacity);
+    ASSERT_EQ(stats.evictions, 2 * capacity);
+}
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    std::atomic_size_t buildsCount{0};
+    auto intBuilder = [&](const IntKey& key) {
+        buildsCount++;
+        return std::make_shared<int>(key.data);
+    };
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity);
+    // warm up the shared cache
+    for (int i = 0; i < capacity; ++i) {
+        auto intResult = sharedCache->getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    std::vector<MultiCache> vecCache(numThreads, MultiCache(sharedCache));
+
+    auto testRoutine = [&](MultiCache& cache) {
+        // the records created in the other view are visible
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+            ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
+        }
+    }
+
+    ASSERT_EQ(buildsCount.load(), capacity);
+    auto stats = vecCache.front().getStatistics();
+    ASSERT_EQ(stats.hits, numThreads * capacity);
+    ASSERT_EQ(stats.misses, capacity);
+}
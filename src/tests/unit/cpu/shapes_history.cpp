@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include "cache/shapes_history.h"
+#include "openvino/opsets/opset8.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> makeModel(const ov::PartialShape& shape) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    param->set_friendly_name("input name");
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{param}, "ShapesHistory");
+}
+
+std::string historyFile(const std::shared_ptr<ov::Model>& model) {
+    return "./cpu_shapes_" + ShapesHistory::computeModelId(model) + ".txt";
+}
+} // namespace
+
+TEST(ShapesHistoryTests, RecordAndLoad) {
+    auto model = makeModel({-1, 3, -1});
+    std::remove(historyFile(model).c_str());
+
+    const ShapesHistory::InputShapes shapes1 = {{"input name", {1, 3, 16}}};
+    const ShapesHistory::InputShapes shapes2 = {{"input name", {2, 3, 32}}};
+    {
+        ShapesHistory history(".", model);
+        ASSERT_TRUE(history.get().empty());
+        history.record(shapes1);
+        history.record(shapes2);
+        history.record(shapes1);
+        ASSERT_EQ(history.get().size(), size_t(2));
+    }
+
+    ShapesHistory history(".", model);
+    const auto loaded = history.get();
+    ASSERT_EQ(loaded.size(), size_t(2));
+    EXPECT_EQ(loaded[0], shapes1);
+    EXPECT_EQ(loaded[1], shapes2);
+
+    std::remove(historyFile(model).c_str());
+}
+
+TEST(ShapesHistoryTests, GetMostRecent) {
+    auto model = makeModel({-1, 3, -1});
+    ShapesHistory history("", model);
+    const ShapesHistory::InputShapes shapes1 = {{"input name", {4, 3, 16}}};
+    const ShapesHistory::InputShapes shapes2 = {{"input name", {1, 3, 32}}};
+    const ShapesHistory::InputShapes shapes3 = {{"input name", {2, 3, 8}}};
+    history.record(shapes1);
+    history.record(shapes2);
+    history.record(shapes3);
+
+    const auto recent = history.get(2);
+    ASSERT_EQ(recent.size(), size_t(2));
+    EXPECT_EQ(recent[0], shapes2);
+    EXPECT_EQ(recent[1], shapes3);
+    EXPECT_TRUE(history.get(0).empty());
+    EXPECT_EQ(history.get(10).size(), size_t(3));
+}
+
+namespace {
+// a broken file drops the whole history, the new records are written to the file started over
+void checkBrokenFileIsDropped(const std::string& content) {
+    auto model = makeModel({-1, -1});
+    {
+        std::ofstream out(historyFile(model));
+        out << content;
+    }
+
+    const ShapesHistory::InputShapes shapes = {{"input name", {2, 4}}};
+    {
+        ShapesHistory history(".", model);
+        EXPECT_TRUE(history.get().empty());
+        history.record(shapes);
+    }
+
+    ShapesHistory history(".", model);
+    const auto loaded = history.get();
+    ASSERT_EQ(loaded.size(), size_t(1));
+    EXPECT_EQ(loaded[0], shapes);
+
+    std::remove(historyFile(model).c_str());
+}
+} // namespace
+
+TEST(ShapesHistoryTests, TruncatedFile) {
+    checkBrokenFileIsDropped("1\n10 input name 2 1 8\n1\n10 input name 2 1");
+}
+
+TEST(ShapesHistoryTests, HugeNameLength) {
+    checkBrokenFileIsDropped("1\n10 input name 2 1 8\n1\n18446744073709551615 input name 2 1 8\n");
+}
+
+TEST(ShapesHistoryTests, HugeRank) {
+    checkBrokenFileIsDropped("1\n10 input name 2 1 8\n1\n10 input name 4294967296 1 8\n");
+}
+
+TEST(ShapesHistoryTests, HugeInputsNumber) {
+    checkBrokenFileIsDropped("1000000000\n10 input name 2 1 8\n");
+}
+
+TEST(ShapesHistoryTests, NotANumber) {
+    checkBrokenFileIsDropped("1\n10 input name 2 1 x\n");
+}
+
+TEST(ShapesHistoryTests, ModelId) {
+    EXPECT_EQ(ShapesHistory::computeModelId(makeModel({-1, 3})), ShapesHistory::computeModelId(makeModel({-1, 3})));
+    EXPECT_NE(ShapesHistory::computeModelId(makeModel({-1, 3})), ShapesHistory::computeModelId(makeModel({-1, 4})));
+}
@@ -0,0 +1,191 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "openvino/opsets/opset8.hpp"
+#include "partitioning.hpp"
+
+using namespace HeteroPlugin;
+
+namespace {
+
+std::shared_ptr<ov::Node> makeConvolution(const ov::Output<ov::Node>& input, size_t channels, const std::string& name) {
+    const auto inputChannels = input.get_shape()[1];
+    auto weights = ov::opset8::Constant::create(ov::element::f32,
+                                                {channels, inputChannels, 3, 3},
+                                                std::vector<float>(channels * inputChannels * 9, 1.f));
+    weights->set_friendly_name(name + "/weights");
+    auto convolution = std::make_shared<ov::opset8::Convolution>(input,
+                                                                 weights,
+                                                                 ov::Strides{1, 1},
+                                                                 ov::CoordinateDiff{1, 1},
+                                                                 ov::CoordinateDiff{1, 1},
+                                                                 ov::Strides{1, 1});
+    convolution->set_friendly_name(name);
+    return convolution;
+}
+
+std::shared_ptr<ov::Node> makeRelu(const ov::Output<ov::Node>& input, const std::string& name) {
+    auto relu = std::make_shared<ov::opset8::Relu>(input);
+    relu->set_friendly_name(name);
+    return relu;
+}
+
+// Parameter -> first -> middle -> last -> Result, the first and the last are the convolutions when heavyEnds is set
+std::shared_ptr<ov::Model> makeChain(const ov::Shape& shape, bool heavyEnds) {
+    auto parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    parameter->set_friendly_name("parameter");
+    auto first = heavyEnds ? makeConvolution(parameter, shape[1], "first") : makeRelu(parameter, "first");
+    auto middle = heavyEnds ? makeRelu(first, "middle") : makeConvolution(first, shape[1], "middle");
+    auto last = heavyEnds ? makeConvolution(middle, shape[1], "last") : makeRelu(middle, "last");
+    auto result = std::make_shared<ov::opset8::Result>(last);
+    result->set_friendly_name("result");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+}
+
+// the synthetic device profile: all the nodes but the unsupported ones
+DeviceProfile querySupported(const std::shared_ptr<ov::Model>& model,
+                             const std::string& device,
+                             const std::set<std::string>& unsupported = {}) {
+    DeviceProfile profile;
+    profile.name = device;
+    for (auto&& node : model->get_ordered_ops()) {
+        if (!unsupported.count(node->get_friendly_name())) {
+            profile.queryResult.supportedLayersMap.emplace(node->get_friendly_name(), device);
+        }
+    }
+    return profile;
+}
+
+DeviceProfile withGops(DeviceProfile profile, float gops) {
+    profile.gops[ov::element::f32] = gops;
+    return profile;
+}
+
+DeviceProfile withStreams(DeviceProfile profile, unsigned int streams) {
+    profile.streams = streams;
+    return profile;
+}
+
+}  // namespace
+
+TEST(PartitionByCostTest, SingleDeviceGetsAllNodes) {
+    auto model = makeChain({1, 3, 8, 8}, false);
+    auto affinities = PartitionByCost(model, {querySupported(model, "A")});
+    EXPECT_EQ(model->get_ordered_ops().size(), affinities.size());
+    for (auto&& affinity : affinities) {
+        EXPECT_EQ("A", affinity.second) << affinity.first;
+    }
+}
+
+TEST(PartitionByCostTest, AvoidsBoundariesAroundCheapNodes) {
+    // the first fit would make the A-B-A chain, while the transfers cost more than the relus on the slower device
+    auto model = makeChain({1, 3, 8, 8}, false);
+    auto affinities =
+        PartitionByCost(model, {querySupported(model, "A", {"middle"}), querySupported(model, "B")});
+    for (auto&& name : {"parameter", "first", "middle", "middle/weights", "last", "result"}) {
+        ASSERT_EQ(1u, affinities.count(name)) << name;
+        EXPECT_EQ("B", affinities.at(name)) << name;
+    }
+}
+
+TEST(PartitionByCostTest, KeepsHeavyNodesOnFasterDevice) {
+    // the convolutions outweigh the transfers, so only the node unsupported by the faster device is moved
+    auto model = makeChain({1, 64, 32, 32}, true);
+    auto affinities =
+        PartitionByCost(model, {querySupported(model, "A", {"middle"}), querySupported(model, "B")});
+    EXPECT_EQ("A", affinities.at("first"));
+    EXPECT_EQ("B", affinities.at("middle"));
+    EXPECT_EQ("A", affinities.at("last"));
+    // the parameters and the constants follow the consumer, the results follow the producer
+    EXPECT_EQ("A", affinities.at("parameter"));
+    EXPECT_EQ("A", affinities.at("first/weights"));
+    EXPECT_EQ("A", affinities.at("result"));
+}
+
+TEST(PartitionByCostTest, EqualDevicesKeepSingleSubgraph) {
+    auto model = makeChain({1, 64, 32, 32}, true);
+    auto affinities = PartitionByCost(model, {querySupported(model, "A"), querySupported(model, "B")});
+    for (auto&& affinity : affinities) {
+        EXPECT_EQ("A", affinity.second) << affinity.first;
+    }
+}
+
+TEST(PartitionByCostTest, UnsupportedNodesAreNotAssigned) {
+    auto model = makeChain({1, 3, 8, 8}, false);
+    auto affinities = PartitionByCost(model,
+                                      {querySupported(model, "A", {"middle", "last"}),
+                                       querySupported(model, "B", {"last"})});
+    EXPECT_EQ(0u, affinities.count("last"));
+    EXPECT_EQ(0u, affinities.count("result"));
+    EXPECT_EQ(1u, affinities.count("middle"));
+    EXPECT_EQ("B", affinities.at("middle"));
+}
+
+TEST(PartitionByCostTest, ReportedThroughputOverridesPriorities) {
+    // the second device by priority is the faster one
+    auto model = makeChain({1, 64, 32, 32}, true);
+    auto affinities = PartitionByCost(
+        model,
+        {withGops(querySupported(model, "A"), 100.f), withGops(querySupported(model, "B"), 1000.f)});
+    for (auto&& affinity : affinities) {
+        EXPECT_EQ("B", affinity.second) << affinity.first;
+    }
+}
+
+TEST(PartitionByCostTest, PrioritiesAreUsedUnlessAllDevicesReportThroughput) {
+    auto model = makeChain({1, 64, 32, 32}, true);
+    auto affinities =
+        PartitionByCost(model, {querySupported(model, "A"), withGops(querySupported(model, "B"), 1000.f)});
+    for (auto&& affinity : affinities) {
+        EXPECT_EQ("A", affinity.second) << affinity.first;
+    }
+}
+
+TEST(PartitionByCostTest, StreamsSlowDownDevice) {
+    // the devices are equal, but the requests share the first one with the other 3 streams
+    auto model = makeChain({1, 64, 32, 32}, true);
+    auto affinities = PartitionByCost(model,
+                                      {withStreams(withGops(querySupported(model, "A"), 100.f), 4),
+                                       withGops(querySupported(model, "B"), 100.f)});
+    for (auto&& affinity : affinities) {
+        EXPECT_EQ("B", affinity.second) << affinity.first;
+    }
+}
+
+TEST(PartitionByCostTest, SharedConstantFollowsMostOfData) {
+    // the weights are shared by the convolution unsupported by A and the two convolutions on A, so the weights stay
+    // on A with the most of the consumers whichever of them is the first one
+    const ov::Shape shape{1, 64, 32, 32};
+    auto parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    parameter->set_friendly_name("parameter");
+    auto weights = ov::opset8::Constant::create(ov::element::f32, {64, 64, 3, 3}, std::vector<float>(64 * 64 * 9, 1.f));
+    weights->set_friendly_name("weights");
+    auto convolution = [&](const ov::Output<ov::Node>& input, const std::string& name) {
+        auto node = std::make_shared<ov::opset8::Convolution>(input,
+                                                              weights,
+                                                              ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+        node->set_friendly_name(name);
+        return node;
+    };
+    auto first = convolution(parameter, "first");
+    auto second = convolution(first, "second");
+    auto third = convolution(second, "third");
+    auto result = std::make_shared<ov::opset8::Result>(third);
+    result->set_friendly_name("result");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+
+    auto affinities =
+        PartitionByCost(model, {querySupported(model, "A", {"first"}), querySupported(model, "B")});
+    EXPECT_EQ("B", affinities.at("first"));
+    EXPECT_EQ("A", affinities.at("second"));
+    EXPECT_EQ("A", affinities.at("third"));
+    EXPECT_EQ("A", affinities.at("weights"));
+}
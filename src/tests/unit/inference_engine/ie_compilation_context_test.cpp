@@ -13,6 +13,8 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -430,6 +432,103 @@ TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     ASSERT_FALSE(fail);
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithSwappedConstants) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    auto swapConstants = [](CNNNetwork& net) {
+        for (const auto& op : net.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "mul_constant" || op->get_friendly_name() == "add_constant") {
+                const int8_t value = op->get_friendly_name() == "mul_constant" ? 2 : 3;
+                auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                constant->set_friendly_name(op->get_friendly_name());
+                constant->get_output_tensor(0).set_names(op->get_output_tensor(0).get_names());
+                ngraph::replace_node(op, constant);
+            }
+        }
+    };
+    swapConstants(net2);
+    swapConstants(net3);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+// The constants data is hashed in parallel and memoized, the result must not depend on it
+TEST(NetworkContext_CNNNetwork, HashWithLargeConstants) {
+    auto createLargeNetwork = [](float lastValue) {
+        const size_t constantsNum = 4;
+        const ngraph::Shape shape{4, 1024, 1024};
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, shape);
+        std::shared_ptr<ngraph::Node> node = data;
+        for (size_t i = 0; i < constantsNum; ++i) {
+            std::vector<float> values(ngraph::shape_size(shape));
+            for (size_t j = 0; j < values.size(); ++j) {
+                values[j] = static_cast<float>((i * 31 + j) % 1000);
+            }
+            if (i == constantsNum - 1) {
+                values.back() = lastValue;
+            }
+            auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, shape, values);
+            node = std::make_shared<ngraph::opset6::Add>(node, constant);
+        }
+        auto res = std::make_shared<ngraph::opset6::Result>(node);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createLargeNetwork(0.f);
+    auto net2 = createLargeNetwork(0.f);
+    auto net3 = createLargeNetwork(1.f);
+    const auto hash1 = NetworkCompilationContext::computeHash(net1, {});
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(hash1, NetworkCompilationContext::computeHash(net3, {}));
+}
+
+// The constant data modified in place (e.g. through the Python buffer protocol) is hashed again
+TEST(NetworkContext_CNNNetwork, HashAfterInPlaceConstantChange) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    const auto hash = NetworkCompilationContext::computeHash(net1, {});
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net2, {}));
+    for (const auto& op : net1.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            *static_cast<int8_t*>(const_cast<void*>(constant->get_data_ptr())) += 1;
+        }
+    }
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net2, {}));
+}
+
+// The hashes of the read-only memory mapped constants are memoized, they are the same as for the same data in memory
+TEST(NetworkContext_CNNNetwork, HashOfMappedConstants) {
+    const auto fileName = generateTestFilePrefix() + "_weights.bin";
+    const std::vector<float> values = {1.f, 2.f, 3.f, 4.f};
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+    }
+    auto createNetworkWithConstant = [](const std::shared_ptr<ngraph::opset6::Constant>& constant) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{4});
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    {
+        auto mapped = ov::util::load_mmap_object(fileName);
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped->data(), mapped->size(), mapped);
+        auto net1 = createNetworkWithConstant(
+            std::make_shared<ngraph::opset6::Constant>(ngraph::element::f32, ngraph::Shape{4}, buffer));
+        auto net2 = createNetworkWithConstant(
+            ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{4}, values));
+        const auto hash = NetworkCompilationContext::computeHash(net1, {});
+        ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net1, {}));
+        ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net2, {}));
+    }
+    std::remove(fileName.c_str());
+}
+
 ////////////////////////////////////////////
 
 TEST(NetworkContext_ModelName, HashOfSame) {
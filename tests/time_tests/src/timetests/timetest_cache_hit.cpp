@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <openvino/runtime/core.hpp>
+
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ * The pipeline measures the latency of `compile_model` when the model is found in the cache:
+ * the cache lookup hash of a model which is read from the file for the first time and of the same model object
+ * compiled once again (the hashes of the memory mapped weights are memoized).
+ */
+int runPipeline(const std::string &model, const std::string &device, const bool isCacheEnabled,
+                std::map<std::string, ov::PartialShape> reshapeShapes,
+                std::map<std::string, std::vector<size_t>> dataShapes) {
+    auto pipeline = [](const std::string &model, const std::string &device) {
+        ov::Core ie;
+        std::shared_ptr<ov::Model> cnnNetwork;
+        ov::CompiledModel exeNetwork;
+
+        {
+            SCOPED_TIMER(load_plugin);
+            TimeTest::setPerformanceConfig(ie, device);
+            ie.get_versions(device);
+            ie.set_property({{CONFIG_KEY(CACHE_DIR), "models_cache"}});
+        }
+        {
+            SCOPED_TIMER(fill_cache);
+            // the first run of the pipeline exports the model to the cache, the next ones import it
+            exeNetwork = ie.compile_model(ie.read_model(model), device);
+            exeNetwork = {};
+        }
+        {
+            // the weights of the model read once again are not hashed yet
+            SCOPED_TIMER(read_network);
+            cnnNetwork = ie.read_model(model);
+        }
+        {
+            SCOPED_TIMER(load_network_cache_hit);
+            exeNetwork = ie.compile_model(cnnNetwork, device);
+            exeNetwork = {};
+        }
+        {
+            SCOPED_TIMER(load_network_cache_hit_same_model);
+            exeNetwork = ie.compile_model(cnnNetwork, device);
+        }
+    };
+
+    try {
+        pipeline(model, device);
+    } catch (const ov::Exception &iex) {
+        std::cerr
+                << "Inference Engine pipeline failed with Inference Engine exception:\n"
+                << iex.what();
+        return 1;
+    } catch (const std::exception &ex) {
+        std::cerr << "Inference Engine pipeline failed with exception:\n"
+                  << ex.what();
+        return 2;
+    } catch (...) {
+        std::cerr << "Inference Engine pipeline failed\n";
+        return 3;
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <openvino/runtime/core.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include <iostream>
+#include <random>
+#include <set>
+
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+
+
+/**
+ * @brief Cuts the first NMS family operation out of the detector, its non-constant inputs become the f32 parameters
+ * of the same shapes.
+ */
+std::shared_ptr<ov::Model> extractPostprocessing(const std::shared_ptr<ov::Model> &detector) {
+    static const std::set<std::string> nmsFamily = {"NonMaxSuppression", "MulticlassNms", "MatrixNms", "DetectionOutput"};
+    for (const auto &op : detector->get_ordered_ops()) {
+        if (!nmsFamily.count(op->get_type_info().name))
+            continue;
+
+        ov::ParameterVector parameters;
+        ov::OutputVector inputs;
+        for (const auto &input : op->inputs()) {
+            auto source = input.get_source_output();
+            if (ov::as_type_ptr<ov::opset8::Constant>(source.get_node_shared_ptr())) {
+                inputs.push_back(source);
+                continue;
+            }
+            if (input.get_partial_shape().is_dynamic())
+                throw std::logic_error("The post-processing input shapes must be static, reshape the model first");
+            if (!input.get_element_type().is_real())
+                throw std::logic_error("Only the floating point post-processing inputs are supported");
+            // the inputs are filled in f32, the other precisions are converted inside the model
+            parameters.push_back(std::make_shared<ov::opset8::Parameter>(ov::element::f32, input.get_shape()));
+            if (input.get_element_type() == ov::element::f32)
+                inputs.push_back(parameters.back());
+            else
+                inputs.push_back(std::make_shared<ov::opset8::Convert>(parameters.back(), input.get_element_type()));
+        }
+        auto postprocessing = op->clone_with_new_inputs(inputs);
+        ov::ResultVector results;
+        for (const auto &output : postprocessing->outputs())
+            results.push_back(std::make_shared<ov::opset8::Result>(output));
+        return std::make_shared<ov::Model>(results, parameters, op->get_friendly_name());
+    }
+    throw std::logic_error("The model has no NonMaxSuppression, MulticlassNms, MatrixNms or DetectionOutput operation");
+}
+
+
+/**
+ * @brief Fills the boxes and the scores with the values in [0, 1] quantized to 1e-3 like the real scores are,
+ * so most of the candidates are tied by the score.
+ */
+void fillPostprocessingInputs(ov::InferRequest &inferRequest, const std::vector<ov::Output<const ov::Node>> &inputs) {
+    std::default_random_engine random(1);
+    std::uniform_int_distribution<int32_t> distribution(0, 1000);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        ov::Tensor tensor{ov::element::f32, inputs[i].get_shape()};
+        auto *data = tensor.data<float>();
+        for (size_t j = 0; j < tensor.get_size(); ++j)
+            data[j] = static_cast<float>(distribution(random)) / 1000.f;
+        inferRequest.set_input_tensor(i, tensor);
+    }
+}
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ * The pipeline measures the post-processing of the detector (YOLO, SSD and so on) alone: its NMS family operation
+ * is compiled without the backbone, with the inputs of the same shapes.
+ */
+int runPipeline(const std::string &model, const std::string &device, const bool isCacheEnabled,
+                std::map<std::string, ov::PartialShape> reshapeShapes,
+                std::map<std::string, std::vector<size_t>> dataShapes) {
+    auto pipeline = [](const std::string &model, const std::string &device,
+                       std::map<std::string, ov::PartialShape> reshapeShapes) {
+        ov::Core ie;
+        std::shared_ptr<ov::Model> postprocessing;
+        ov::CompiledModel exeNetwork;
+        ov::InferRequest inferRequest;
+
+        {
+            SCOPED_TIMER(load_plugin);
+            TimeTest::setPerformanceConfig(ie, device);
+            ie.get_versions(device);
+        }
+        {
+            SCOPED_TIMER(read_network);
+            auto detector = ie.read_model(model);
+            if (!reshapeShapes.empty())
+                detector->reshape(reshapeShapes);
+            postprocessing = extractPostprocessing(detector);
+        }
+        {
+            SCOPED_TIMER(load_network);
+            exeNetwork = ie.compile_model(postprocessing, device);
+            inferRequest = exeNetwork.create_infer_request();
+        }
+        {
+            SCOPED_TIMER(first_inference);
+            {
+                SCOPED_TIMER(fill_inputs);
+                fillPostprocessingInputs(inferRequest, exeNetwork.inputs());
+            }
+            inferRequest.infer();
+        }
+        {
+            SCOPED_TIMER(inference);
+            inferRequest.infer();
+        }
+    };
+
+    try {
+        pipeline(model, device, reshapeShapes);
+    } catch (const ov::Exception &iex) {
+        std::cerr
+                << "Inference Engine pipeline failed with Inference Engine exception:\n"
+                << iex.what();
+        return 1;
+    } catch (const std::exception &ex) {
+        std::cerr << "Inference Engine pipeline failed with exception:\n"
+                  << ex.what();
+        return 2;
+    } catch (...) {
+        std::cerr << "Inference Engine pipeline failed\n";
+        return 3;
+    }
+    return 0;
+}